@@ -0,0 +1,770 @@
+// AntSimulation - An SFML simulation of an ant colony.
+// Copyright (C) 2025 Logan Herrera <jherre36@live.nmhu.edu>
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+
+// ant_bench: reproducible micro and macro benchmarks for the simulation hot paths.
+// Every fixture is built from a fixed seed, so two runs of the same build do the same work and report the
+// same checksum; only the timings differ. Results are written as JSON (one object per benchmark) so runs
+// can be diffed or plotted. Progress goes to stderr, the JSON to stdout or --output.
+//
+//   ./bin/ant_bench                        run everything
+//   ./bin/ant_bench --filter colony_update only benchmarks whose name contains the text
+//   ./bin/ant_bench --max-ants 100000      skip the population sizes above N
+//   ./bin/ant_bench --output base.json     write the JSON to a file
+//   ./bin/ant_bench --self-check           compare every SIMD kernel with its scalar reference instead
+//                                          (exit code 1 on any mismatch; registered as a CTest test)
+//
+// On Linux each result also carries hardware counters (cycles, instructions, L1D / LLC / branch misses)
+// per iteration and per item when perf_event_open is allowed; otherwise only wall time is reported and
+// "hardware_counters" says why.
+
+#include "Ant.hpp"
+#include "AntRenderer.hpp"
+#include "Colony.hpp"
+#include "DecisionKernels.hpp"
+#include "Environment.hpp"
+#include "InterleavedPheromones.hpp"
+#include "PerfCounters.hpp"
+#include "PheromoneKernels.hpp"
+#include "RandomUtils.hpp"
+#include "WorldSnapshot.hpp"
+#include <SFML/Graphics.hpp>
+#include <chrono>
+#include <cstring>
+#include <cstdint>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#if defined(_WIN32)
+#define NOMINMAX
+#include <windows.h>
+#include <psapi.h>
+#else
+#include <sys/resource.h>
+#endif
+
+namespace {
+
+constexpr std::uint64_t DEFAULT_SEED = 20250101;
+constexpr float BENCH_CELL_SIZE = 1.0f; // Only affects drawing; the renderer benchmark builds vertices only
+
+struct BenchResult {
+    std::string name;
+    std::string item;              // What items_per_sec counts ("ant", "cell", "decision", ...)
+    unsigned long long iterations; // Timed calls (ticks, decay steps, decisions, frames)
+    double nsPerIteration;
+    double itemsPerSecond;
+    long long peakRssKb;           // Peak resident set of the whole process so far
+    std::uint64_t checksum;        // Same for every run of a build with the same seed; guards against dead code elimination
+    bool counted;                  // Hardware counters were read around the timed loop
+    PerfSample counters;           // Totals over the timed loop (per-iteration and per-item figures are derived when written)
+    double items;
+};
+
+// Wall time and, where available, hardware counters of one timed loop
+struct Measurement {
+    double seconds = 0.0;
+    bool counted = false;
+    PerfSample counters;
+};
+
+// Starts timing on construction; stop() returns the elapsed time and counter deltas of this thread
+class Stopwatch {
+public:
+    Stopwatch()
+        : m_counters(PerfCounters::forThisThread())
+    {
+        m_counting = m_counters.read(m_counterStart);
+        m_start = std::chrono::steady_clock::now();
+    }
+
+    Measurement stop() {
+        Measurement result;
+        result.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - m_start).count();
+        PerfSample counterEnd;
+        if (m_counting && m_counters.read(counterEnd)) {
+            result.counted = true;
+            result.counters = counterEnd - m_counterStart;
+        }
+        return result;
+    }
+
+private:
+    PerfCounters& m_counters;
+    bool m_counting;
+    PerfSample m_counterStart;
+    std::chrono::steady_clock::time_point m_start;
+};
+
+struct BenchConfig {
+    std::uint64_t seed = DEFAULT_SEED;
+    std::string filter;
+    unsigned long long maxAnts = 1000000;
+    std::string outputPath;
+    bool selfCheck = false;
+};
+
+// Peak resident set size in KiB (0 where the platform does not report it)
+long long peakRssKb() {
+#if defined(_WIN32)
+    PROCESS_MEMORY_COUNTERS counters;
+    if (GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters))) {
+        return static_cast<long long>(counters.PeakWorkingSetSize / 1024);
+    }
+    return 0;
+#else
+    struct rusage usage;
+    if (getrusage(RUSAGE_SELF, &usage) != 0) {
+        return 0;
+    }
+#if defined(__APPLE__)
+    return static_cast<long long>(usage.ru_maxrss / 1024); // Bytes on macOS
+#else
+    return static_cast<long long>(usage.ru_maxrss);        // KiB on Linux
+#endif
+#endif
+}
+
+BenchResult makeResult(const std::string& name, const std::string& item, unsigned long long iterations,
+    const Measurement& measured, double items, std::uint64_t checksum) {
+    const double seconds = measured.seconds;
+    BenchResult result;
+    result.name = name;
+    result.item = item;
+    result.iterations = iterations;
+    result.nsPerIteration = iterations > 0 ? seconds * 1e9 / static_cast<double>(iterations) : 0.0;
+    result.itemsPerSecond = seconds > 0.0 ? items / seconds : 0.0;
+    result.peakRssKb = peakRssKb();
+    result.checksum = checksum;
+    result.counted = measured.counted;
+    result.counters = measured.counters;
+    result.items = items;
+    return result;
+}
+
+// A world with food placed from the seed, the same way Simulation places it
+void placeFood(Environment& env, std::uint64_t seed) {
+    CounterRng rng(seed, 0, 0, 0, CounterRng::World);
+    env.generateFood(rng);
+}
+
+// Scatters the colony's ants over the world and lays a trail pattern covering about coverage of the cells,
+// so decision kernels see a realistic mix of empty, weak and strong neighbours
+void scatterFixture(Colony& colony, int width, int height, float coverage, std::uint64_t seed) {
+    CounterRng rng(seed, 1, static_cast<std::uint32_t>(colony.id), 0, CounterRng::World);
+    for (size_t i = 0; i < colony.ants.slotCount(); ++i) {
+        colony.ants.x[i] = static_cast<int>(rng.below(static_cast<std::uint32_t>(width)));
+        colony.ants.y[i] = static_cast<int>(rng.below(static_cast<std::uint32_t>(height)));
+        colony.ants.prevX[i] = colony.ants.x[i];
+        colony.ants.prevY[i] = colony.ants.y[i];
+    }
+    const size_t trailCells = static_cast<size_t>(coverage * static_cast<float>(width) * static_cast<float>(height));
+    for (size_t i = 0; i < trailCells; ++i) {
+        const int x = static_cast<int>(rng.below(static_cast<std::uint32_t>(width)));
+        const int y = static_cast<int>(rng.below(static_cast<std::uint32_t>(height)));
+        colony.addFoodPheromone(x, y, rng.uniform(1.0f, Colony::MAX_PHEROMONE_LEVEL));
+        colony.addReturnHomePheromone(x, y, rng.uniform(1.0f, Colony::MAX_PHEROMONE_LEVEL));
+    }
+}
+
+// --- Full colony tick (Colony::update) ---
+// One colony of N ants on a world big enough that they do not all pile into the same cells.
+// Ants all start at home, so a few warm-up ticks spread them out before timing starts.
+BenchResult benchColonyUpdate(unsigned long long antCount, unsigned warmupTicks, unsigned timedTicks, std::uint64_t seed) {
+    const int size = antCount >= 100000 ? 1024 : 512;
+    Environment env(BENCH_CELL_SIZE, size, size);
+    placeFood(env, seed);
+
+    std::vector<Colony> colonies;
+    colonies.emplace_back(size / 2, size / 2, static_cast<int>(antCount), sf::Color::Red, 0, size, size,
+        PheromoneDecayMode::Eager, seed);
+    Colony& colony = colonies.front();
+
+    for (unsigned t = 0; t < warmupTicks; ++t) {
+        colony.update(env, colonies);
+    }
+
+    double antsUpdated = 0.0;
+    Stopwatch stopwatch;
+    for (unsigned t = 0; t < timedTicks; ++t) {
+        antsUpdated += static_cast<double>(colony.ants.size());
+        colony.update(env, colonies);
+    }
+    const Measurement measured = stopwatch.stop();
+
+    std::uint64_t checksum = colony.ants.size();
+    for (size_t i = 0; i < colony.ants.slotCount(); ++i) {
+        if (!colony.ants.alive[i]) {
+            continue;
+        }
+        checksum = checksum * 31 + static_cast<std::uint64_t>(colony.ants.x[i] * 4099 + colony.ants.y[i]);
+    }
+    return makeResult("colony_update/ants=" + std::to_string(antCount), "ant", timedTicks, measured, antsUpdated, checksum);
+}
+
+// --- Pheromone decay alone (Colony::updatePheromones) ---
+// items_per_sec counts live cells aged per second. Lazy mode ages them without visiting them, so its rate
+// is only comparable with other lazy runs. Dense runs keep their original names; tiled ones get a suffix.
+std::string pheromoneDecayName(int size, PheromoneDecayMode mode, float coverage, WorldStorage storage) {
+    std::ostringstream name;
+    name << "update_pheromones/grid=" << size << "x" << size << "/coverage=" << static_cast<int>(coverage * 100.0f)
+        << "%/" << (mode == PheromoneDecayMode::Lazy ? "lazy" : "eager")
+        << (storage == WorldStorage::Tiled ? "/tiled" : "");
+    return name.str();
+}
+
+BenchResult benchPheromoneDecay(int size, PheromoneDecayMode mode, float coverage, WorldStorage storage,
+    unsigned timedTicks, std::uint64_t seed) {
+    // Counting live cells scans every chunk in Tiled storage, so the per-tick counts come from an identical
+    // untimed replay instead of from inside the timed loop
+    double cellsVisited = 0.0;
+    {
+        Colony replay(size / 2, size / 2, 0, sf::Color::Red, 0, size, size, mode, seed, storage);
+        scatterFixture(replay, size, size, coverage, seed);
+        for (unsigned t = 0; t < timedTicks; ++t) {
+            cellsVisited += static_cast<double>(replay.pheromones.activeCellCount());
+            replay.updatePheromones();
+        }
+    }
+
+    Colony colony(size / 2, size / 2, 0, sf::Color::Red, 0, size, size, mode, seed, storage);
+    scatterFixture(colony, size, size, coverage, seed);
+    Stopwatch stopwatch;
+    for (unsigned t = 0; t < timedTicks; ++t) {
+        colony.updatePheromones();
+    }
+    const Measurement measured = stopwatch.stop();
+
+    std::uint64_t checksum = colony.pheromones.activeCellCount();
+    colony.pheromones.forEachActiveCell([&checksum](std::uint64_t, float, float foodLevel) {
+        checksum = checksum * 31 + static_cast<std::uint64_t>(foodLevel * 1000.0f);
+    });
+    return makeResult(pheromoneDecayName(size, mode, coverage, storage), "cell", timedTicks, measured, cellsVisited, checksum);
+}
+
+// --- Separate vs interleaved pheromone layout, on the same three-colony fixture ---
+// "sense" reads the food and home neighbourhoods of every colony around one cell (what cross-colony sensing
+// would need; items are cells sensed), "decay" is one tick of decay for all colonies (items are grid cells).
+// Interleaved levels are half floats, so its checksums differ slightly from the separate layout's.
+const int LAYOUT_COLONIES = 3;
+
+std::string pheromoneLayoutName(PheromoneLayout layout, int size, const std::string& operation) {
+    return std::string("pheromone_layout/") + (layout == PheromoneLayout::Interleaved ? "interleaved" : "separate")
+        + "/grid=" + std::to_string(size) + "x" + std::to_string(size) + "/" + operation;
+}
+
+BenchResult benchPheromoneLayout(PheromoneLayout layout, int size, bool sense, unsigned long long iterations, std::uint64_t seed) {
+    std::unique_ptr<InterleavedPheromones> shared;
+    if (layout == PheromoneLayout::Interleaved) {
+        shared = std::make_unique<InterleavedPheromones>(size, size);
+    }
+    std::vector<Colony> colonies;
+    colonies.reserve(LAYOUT_COLONIES);
+    for (int c = 0; c < LAYOUT_COLONIES; ++c) {
+        colonies.emplace_back(size / 2, size / 2, 0, sf::Color::Red, c, size, size, PheromoneDecayMode::Eager, seed,
+            WorldStorage::Dense, shared.get());
+        scatterFixture(colonies.back(), size, size, 0.3f, seed);
+    }
+
+    std::uint64_t checksum = 0;
+    Stopwatch stopwatch;
+    if (sense) {
+        CounterRng rng(seed, 3, 0, 0, CounterRng::World);
+        float levels[Directions::COUNT];
+        for (unsigned long long i = 0; i < iterations; ++i) {
+            const int x = static_cast<int>(rng.below(static_cast<std::uint32_t>(size)));
+            const int y = static_cast<int>(rng.below(static_cast<std::uint32_t>(size)));
+            float total = 0.0f;
+            for (const Colony& colony : colonies) {
+                colony.getFoodPheromoneNeighbors(x, y, levels);
+                for (float level : levels) total += level;
+                colony.getReturnHomePheromoneNeighbors(x, y, levels);
+                for (float level : levels) total += level;
+            }
+            checksum = checksum * 31 + static_cast<std::uint64_t>(total);
+        }
+    }
+    else {
+        for (unsigned long long t = 0; t < iterations; ++t) {
+            // With the interleaved layout the first colony decays the shared grid for all of them
+            for (Colony& colony : colonies) {
+                colony.updatePheromones();
+            }
+        }
+        for (const Colony& colony : colonies) {
+            checksum = checksum * 31 + colony.pheromones.activeCellCount();
+        }
+    }
+    const Measurement measured = stopwatch.stop();
+    const double items = sense ? static_cast<double>(iterations) : static_cast<double>(iterations) * size * size;
+    return makeResult(pheromoneLayoutName(layout, size, sense ? "sense" : "decay"), "cell",
+        iterations, measured, items, checksum);
+}
+
+// --- Decision kernels on a fixed fixture ---
+// Each call loads an ant from the store (as Colony does) and runs one kernel on the copy; the store is
+// never written, so every iteration sees the same inputs.
+BenchResult benchAntKernel(const std::string& kernelName,
+    const std::function<void(Ant&, const Colony&, const Environment&)>& kernel,
+    unsigned long long decisions, std::uint64_t seed) {
+    const int size = 256;
+    const int fixtureAnts = 4096;
+    Environment env(BENCH_CELL_SIZE, size, size);
+    placeFood(env, seed);
+    Colony colony(size / 2, size / 2, fixtureAnts, sf::Color::Red, 0, size, size, PheromoneDecayMode::Eager, seed);
+    scatterFixture(colony, size, size, 0.2f, seed);
+
+    std::uint64_t checksum = 0;
+    Stopwatch stopwatch;
+    for (unsigned long long i = 0; i < decisions; ++i) {
+        Ant ant(colony.ants, static_cast<size_t>(i % fixtureAnts), colony.homeX, colony.homeY);
+        kernel(ant, colony, env);
+        checksum = checksum * 31 + static_cast<std::uint64_t>(ant.x * 4099 + ant.y * 8 + ant.direction);
+    }
+    const Measurement measured = stopwatch.stop();
+    return makeResult("ant_kernel/" + kernelName, "decision", decisions, measured, static_cast<double>(decisions), checksum);
+}
+
+// --- Weighted direction choice alone: the old per-candidate vectors against the 8-lane kernels ---
+// Inputs are pre-generated so both sides weigh the same 4096 neighbourhoods; ~30% of the lanes hold no
+// trail and a few are blocked, like a trail-following ant sees them.
+struct DecisionFixture {
+    std::vector<DecisionKernels::Lanes> lanes;
+    std::vector<float> randoms; // uniform [0, 1), scaled by each total like CounterRng::uniform(0, total)
+};
+
+DecisionFixture makeDecisionFixture(std::uint64_t seed) {
+    const size_t count = 4096;
+    CounterRng rng(seed, 2, 0, 0, CounterRng::World);
+    DecisionFixture fixture;
+    fixture.lanes.resize(count);
+    fixture.randoms.resize(count);
+    for (size_t i = 0; i < count; ++i) {
+        DecisionKernels::Lanes& lanes = fixture.lanes[i];
+        lanes.currentDistance = rng.uniform(1.0f, 40.0f);
+        for (int d = 0; d < Directions::COUNT; ++d) {
+            lanes.levels[d] = rng.below(10) < 3 ? 0.0f : rng.uniform(0.0f, Colony::MAX_PHEROMONE_LEVEL);
+            lanes.distances[d] = lanes.currentDistance + rng.uniform(-1.5f, 1.5f);
+        }
+        lanes.candidates = 0xFFu & ~(1u << rng.below(8));
+        lanes.recent = rng.below(256) & rng.below(256);
+        fixture.randoms[i] = rng.uniform();
+    }
+    return fixture;
+}
+
+// The followFoodPheromones loop as it was before the lane kernels: two vectors per call, filled per candidate
+int legacyWeightedPick(const DecisionKernels::Lanes& lanes, float random) {
+    std::vector<float> candidatePheromonesWeights;
+    std::vector<int> candidateDirections;
+    float totalWeightSum = 0.0f;
+    for (int i = 0; i < 8; ++i) {
+        if (!((lanes.candidates >> i) & 1u)) continue;
+        float pheromoneLevel = lanes.levels[i];
+        if (pheromoneLevel > 0) {
+            float weight = pheromoneLevel;
+            if ((lanes.recent >> i) & 1u) weight *= 0.5f;
+            if (lanes.distances[i] < lanes.currentDistance) weight *= 0.2f;
+            else if (lanes.distances[i] > lanes.currentDistance) weight *= 1.2f;
+            if (i % 2 != 0) weight *= 1.1f;
+            if (weight > 0.001f) {
+                candidatePheromonesWeights.push_back(weight);
+                candidateDirections.push_back(i);
+                totalWeightSum += weight;
+            }
+        }
+    }
+    if (candidateDirections.empty()) return -1;
+    const float randomPick = totalWeightSum * random;
+    float currentSum = 0.0f;
+    for (size_t j = 0; j < candidatePheromonesWeights.size(); ++j) {
+        currentSum += candidatePheromonesWeights[j];
+        if (randomPick <= currentSum) return candidateDirections[j];
+    }
+    return candidateDirections[0];
+}
+
+BenchResult benchWeightedPick(const std::string& variant, unsigned long long decisions, std::uint64_t seed) {
+    const DecisionFixture fixture = makeDecisionFixture(seed);
+    const DecisionKernels::Rule rule = { 0.0f, 0.001f, 0.5f, 0.2f, 1.2f, 1.1f }; // followFoodPheromones
+    const bool legacy = variant == "legacy_vectors";
+    DecisionKernels::Kernel kernel = DecisionKernels::Kernel::Scalar;
+    if (variant == "sse") kernel = DecisionKernels::Kernel::SSE;
+    if (variant == "avx2") kernel = DecisionKernels::Kernel::AVX2;
+
+    std::uint64_t checksum = 0;
+    Stopwatch stopwatch;
+    for (unsigned long long i = 0; i < decisions; ++i) {
+        const size_t input = static_cast<size_t>(i % fixture.lanes.size());
+        int direction;
+        if (legacy) {
+            direction = legacyWeightedPick(fixture.lanes[input], fixture.randoms[input]);
+        }
+        else {
+            float weights[Directions::COUNT];
+            const unsigned candidates = DecisionKernels::weigh(kernel, fixture.lanes[input], rule, weights);
+            direction = candidates == 0 ? -1
+                : DecisionKernels::pick(weights, candidates, DecisionKernels::total(weights) * fixture.randoms[input]);
+            if (direction == -1 && candidates != 0) direction = DecisionKernels::heaviest(weights, candidates);
+        }
+        checksum = checksum * 31 + static_cast<std::uint64_t>(direction + 1);
+    }
+    const Measurement measured = stopwatch.stop();
+    return makeResult("decision/weighted_pick/" + variant, "decision", decisions, measured, static_cast<double>(decisions), checksum);
+}
+
+// --- Render preparation: snapshot capture and ant vertex building (no GPU needed) ---
+BenchResult benchSnapshotCapture(unsigned long long antCount, unsigned frames, std::uint64_t seed) {
+    const int size = 1024;
+    Colony colony(size / 2, size / 2, static_cast<int>(antCount), sf::Color::Red, 0, size, size, PheromoneDecayMode::Eager, seed);
+    scatterFixture(colony, size, size, 0.1f, seed);
+
+    ColonySnapshot snapshot;
+    snapshot.capture(colony); // First capture allocates; the timed ones reuse the buffers like the simulation thread does
+    Stopwatch stopwatch;
+    for (unsigned f = 0; f < frames; ++f) {
+        snapshot.capture(colony);
+    }
+    const Measurement measured = stopwatch.stop();
+    const std::uint64_t checksum = snapshot.antX.size() * 1000003ull + snapshot.pheromoneCells.size();
+    return makeResult("render_prep/snapshot_capture/ants=" + std::to_string(antCount), "ant", frames, measured,
+        static_cast<double>(antCount) * frames, checksum);
+}
+
+BenchResult benchAntVertices(unsigned long long antCount, unsigned frames, std::uint64_t seed) {
+    const int size = 1024;
+    Colony colony(size / 2, size / 2, static_cast<int>(antCount), sf::Color::Red, 0, size, size, PheromoneDecayMode::Eager, seed);
+    scatterFixture(colony, size, size, 0.0f, seed);
+    WorldSnapshot snapshot;
+    snapshot.width = size;
+    snapshot.height = size;
+    snapshot.colonies.resize(1);
+    snapshot.colonies[0].capture(colony);
+
+    sf::Texture antTexture; // Never uploaded; prepare() only reads its size
+    AntRenderer renderer(antTexture, BENCH_CELL_SIZE);
+    std::uint64_t checksum = renderer.prepare(snapshot);
+    Stopwatch stopwatch;
+    for (unsigned f = 0; f < frames; ++f) {
+        checksum += renderer.prepare(snapshot);
+    }
+    const Measurement measured = stopwatch.stop();
+    return makeResult("render_prep/ant_vertices/ants=" + std::to_string(antCount), "ant", frames, measured,
+        static_cast<double>(antCount) * frames, checksum);
+}
+
+// --- Self check: every SIMD kernel must match the scalar reference bit for bit ---
+// Inputs mix random bit patterns (NaN, infinities, denormals and negatives included) with values a few
+// ulps either side of the threshold and of threshold / rate, and every kernel runs on a range of start
+// offsets (unaligned loads) and lengths (vector bodies plus every tail length). Returns the mismatch count.
+float floatFromBits(std::uint32_t bits) {
+    float value;
+    std::memcpy(&value, &bits, sizeof(value));
+    return value;
+}
+
+std::uint32_t bitsOf(float value) {
+    std::uint32_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    return bits;
+}
+
+std::vector<float> makeDecayInputs(size_t count, float rate, float threshold, std::uint64_t seed) {
+    const std::uint32_t special[] = {
+        0x00000000u, 0x80000000u, 0x00000001u, 0x007FFFFFu, 0x00800000u, // zeros, denormals, smallest normal
+        0x7F800000u, 0xFF800000u, 0x7FC00000u, 0xFFC00001u, 0x7F800001u, // infinities, quiet and signalling NaN
+        0x7F7FFFFFu, 0xBF800000u                                          // largest float, -1
+    };
+    CounterRng rng(seed, 4, 0, 0, CounterRng::World);
+    std::vector<float> values(count);
+    for (size_t i = 0; i < count; ++i) {
+        const std::uint32_t pick = rng.below(8);
+        if (pick == 0) {
+            values[i] = floatFromBits(special[rng.below(sizeof(special) / sizeof(special[0]))]);
+        }
+        else if (pick <= 2) {
+            const float centre = pick == 1 ? threshold : threshold / rate; // Where "keep" flips, before and after the multiply
+            values[i] = floatFromBits(bitsOf(centre) + rng.below(33) - 16);
+        }
+        else if (pick <= 4) {
+            values[i] = floatFromBits(rng()); // Any bit pattern at all
+        }
+        else {
+            values[i] = rng.uniform(0.0f, PheromoneField::MAX_LEVEL);
+        }
+    }
+    return values;
+}
+
+size_t runSelfCheck(std::uint64_t seed) {
+    using Kernel = PheromoneKernels::DecayKernel;
+    const float rate = PheromoneField::DECAY_RATE;
+    const float threshold = PheromoneField::ZERO_THRESHOLD;
+    const size_t maxOffset = 16;
+    const size_t lengths[] = { 0, 1, 2, 3, 4, 5, 7, 8, 9, 15, 16, 17, 31, 33, 63, 64, 65, 1000, 4099 };
+    const size_t capacity = maxOffset + 4099;
+    size_t mismatches = 0;
+
+    const std::vector<float> food = makeDecayInputs(capacity, rate, threshold, seed);
+    const std::vector<float> home = makeDecayInputs(capacity, rate, threshold, seed + 1);
+    // Halves: every 16-bit pattern once (NaN, infinity, subnormal and negative halves included), then random ones
+    std::vector<std::uint16_t> halves(65536 + capacity);
+    CounterRng rng(seed, 5, 0, 0, CounterRng::World);
+    for (size_t i = 0; i < halves.size(); ++i) {
+        halves[i] = static_cast<std::uint16_t>(i < 65536 ? i : rng());
+    }
+
+    for (Kernel kernel : { Kernel::SSE, Kernel::AVX2 }) {
+        const char* name = PheromoneKernels::kernelName(kernel);
+        if (!PheromoneKernels::isSupported(kernel)) {
+            std::cerr << "self-check: " << name << " not supported on this CPU, skipped\n";
+            continue;
+        }
+        size_t kernelMismatches = 0;
+        for (size_t offset = 0; offset < maxOffset; ++offset) {
+            for (size_t length : lengths) {
+                std::vector<float> expectedFood(food), expectedHome(home), actualFood(food), actualHome(home);
+                PheromoneKernels::decay(Kernel::Scalar, expectedFood.data() + offset, expectedHome.data() + offset, length, rate, threshold);
+                PheromoneKernels::decay(kernel, actualFood.data() + offset, actualHome.data() + offset, length, rate, threshold);
+                for (size_t i = 0; i < capacity; ++i) {
+                    if (bitsOf(expectedFood[i]) != bitsOf(actualFood[i]) || bitsOf(expectedHome[i]) != bitsOf(actualHome[i])) {
+                        if (kernelMismatches++ < 5) {
+                            std::cerr << "self-check: decay/" << name << " offset " << offset << " length " << length
+                                << " cell " << i << ": input 0x" << std::hex << bitsOf(food[i]) << "/0x" << bitsOf(home[i])
+                                << " gave 0x" << bitsOf(actualFood[i]) << "/0x" << bitsOf(actualHome[i])
+                                << ", scalar 0x" << bitsOf(expectedFood[i]) << "/0x" << bitsOf(expectedHome[i]) << std::dec << "\n";
+                        }
+                    }
+                }
+            }
+        }
+
+        // The exhaustive pass, then the offsets and lengths on the random tail
+        std::vector<std::uint16_t> expected(halves), actual(halves);
+        PheromoneKernels::decayHalf(Kernel::Scalar, expected.data(), 65536, rate, threshold);
+        PheromoneKernels::decayHalf(kernel, actual.data(), 65536, rate, threshold);
+        for (size_t offset = 0; offset < maxOffset; ++offset) {
+            for (size_t length : lengths) {
+                std::vector<std::uint16_t> expectedTail(halves.begin() + 65536, halves.end());
+                std::vector<std::uint16_t> actualTail(expectedTail);
+                PheromoneKernels::decayHalf(Kernel::Scalar, expectedTail.data() + offset, length, rate, threshold);
+                PheromoneKernels::decayHalf(kernel, actualTail.data() + offset, length, rate, threshold);
+                expected.insert(expected.end(), expectedTail.begin(), expectedTail.end());
+                actual.insert(actual.end(), actualTail.begin(), actualTail.end());
+            }
+        }
+        for (size_t i = 0; i < expected.size(); ++i) {
+            if (expected[i] != actual[i] && kernelMismatches++ < 10) {
+                std::cerr << "self-check: decayHalf/" << name << " element " << i << ": input 0x" << std::hex
+                    << halves[i < 65536 ? i : 65536 + (i - 65536) % capacity] << " gave 0x" << actual[i]
+                    << ", scalar 0x" << expected[i] << std::dec << "\n";
+            }
+        }
+        std::cerr << "self-check: " << name << (kernelMismatches == 0 ? " matches scalar\n" : " MISMATCHES scalar\n");
+        mismatches += kernelMismatches;
+    }
+    return mismatches;
+}
+
+std::string jsonEscape(const std::string& text) {
+    std::string out;
+    for (char c : text) {
+        if (c == '"' || c == '\\') out += '\\';
+        out += c;
+    }
+    return out;
+}
+
+// {"cycles": x, ...} with every counter divided by divisor; counters that could not be opened are null
+void writeCounters(std::ostream& out, const PerfSample& totals, double divisor) {
+    const PerfCounters& counters = PerfCounters::forThisThread();
+    out << "{";
+    for (int e = 0; e < PERF_EVENT_COUNT; ++e) {
+        const PerfEvent event = static_cast<PerfEvent>(e);
+        out << (e == 0 ? "" : ", ") << "\"" << PerfCounters::eventName(event) << "\": ";
+        if (counters.has(event) && divisor > 0.0) {
+            out << static_cast<double>(totals.value[e]) / divisor;
+        }
+        else {
+            out << "null";
+        }
+    }
+    out << "}";
+}
+
+void writeJson(std::ostream& out, const BenchConfig& config, const std::vector<BenchResult>& results) {
+    const PerfCounters& counters = PerfCounters::forThisThread();
+    out << "{\n  \"benchmark\": \"ant_bench\",\n  \"seed\": " << config.seed
+        << ",\n  \"hardware_counters\": \"" << jsonEscape(counters.available()
+            ? (counters.reason().empty() ? std::string("available") : "partial: " + counters.reason())
+            : "unavailable: " + counters.reason()) << "\""
+        << ",\n  \"results\": [";
+    for (size_t i = 0; i < results.size(); ++i) {
+        const BenchResult& r = results[i];
+        out << (i == 0 ? "\n" : ",\n")
+            << "    {\"name\": \"" << jsonEscape(r.name) << "\""
+            << ", \"iterations\": " << r.iterations
+            << ", \"ns_per_iteration\": " << static_cast<long long>(r.nsPerIteration)
+            << ", \"items_per_sec\": " << static_cast<long long>(r.itemsPerSecond)
+            << ", \"item\": \"" << r.item << "\""
+            << ", \"peak_rss_kb\": " << r.peakRssKb
+            << ", \"checksum\": " << r.checksum;
+        if (r.counted) {
+            out << ", \"counters_per_iteration\": ";
+            writeCounters(out, r.counters, static_cast<double>(r.iterations));
+            out << ", \"counters_per_item\": ";
+            writeCounters(out, r.counters, r.items);
+        }
+        out << "}";
+    }
+    out << "\n  ]\n}\n";
+}
+
+bool parseBenchArgs(int argc, char* argv[], BenchConfig& config) {
+    for (int i = 1; i < argc; ++i) {
+        const std::string arg = argv[i];
+        const bool hasValue = i + 1 < argc;
+        try {
+            if (arg == "--seed" && hasValue) config.seed = std::stoull(argv[++i]);
+            else if (arg == "--filter" && hasValue) config.filter = argv[++i];
+            else if (arg == "--max-ants" && hasValue) config.maxAnts = std::stoull(argv[++i]);
+            else if (arg == "--output" && hasValue) config.outputPath = argv[++i];
+            else if (arg == "--self-check") config.selfCheck = true;
+            else {
+                std::cerr << "Usage: " << argv[0] << " [--filter TEXT] [--max-ants N] [--seed N] [--output FILE] [--self-check]\n";
+                return false;
+            }
+        }
+        catch (const std::exception&) {
+            std::cerr << "Error: " << arg << " expects a number.\n";
+            return false;
+        }
+    }
+    return true;
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    BenchConfig config;
+    if (!parseBenchArgs(argc, argv, config)) {
+        return 1;
+    }
+    if (config.selfCheck) {
+        const size_t mismatches = runSelfCheck(config.seed);
+        std::cerr << (mismatches == 0 ? "self-check passed\n" : "self-check FAILED: " + std::to_string(mismatches) + " mismatches\n");
+        return mismatches == 0 ? 0 : 1;
+    }
+
+    std::vector<BenchResult> results;
+    // Runs a benchmark if its name passes the filter. Names are known before the fixture is built.
+    auto run = [&](const std::string& name, const std::function<BenchResult()>& bench) {
+        if (!config.filter.empty() && name.find(config.filter) == std::string::npos) {
+            return;
+        }
+        std::cerr << "running " << name << "...\n";
+        results.push_back(bench());
+        std::cerr << "  " << static_cast<long long>(results.back().nsPerIteration) << " ns/iteration, "
+            << static_cast<long long>(results.back().itemsPerSecond) << " " << results.back().item << "s/sec\n";
+    };
+    const std::uint64_t seed = config.seed;
+
+    // Population sizes run smallest first, so each peak RSS reading belongs to the largest fixture so far
+    struct TickScenario { unsigned long long ants; unsigned warmup, timed; };
+    const TickScenario tickScenarios[] = { {1000, 50, 200}, {10000, 50, 100}, {100000, 20, 20}, {1000000, 5, 5} };
+    for (const TickScenario& s : tickScenarios) {
+        if (s.ants > config.maxAnts) continue;
+        run("colony_update/ants=" + std::to_string(s.ants), [&] { return benchColonyUpdate(s.ants, s.warmup, s.timed, seed); });
+    }
+
+    const int gridSizes[] = { 256, 1024, 2048 };
+    for (int size : gridSizes) {
+        for (PheromoneDecayMode mode : { PheromoneDecayMode::Eager, PheromoneDecayMode::Lazy }) {
+            for (float coverage : { 0.01f, 0.5f }) {
+                run(pheromoneDecayName(size, mode, coverage, WorldStorage::Dense),
+                    [&] { return benchPheromoneDecay(size, mode, coverage, WorldStorage::Dense, 100, seed); });
+            }
+        }
+        // Chunked storage on the same fixtures: sparse coverage should cost about the same, dense coverage a little more
+        for (float coverage : { 0.01f, 0.5f }) {
+            run(pheromoneDecayName(size, PheromoneDecayMode::Eager, coverage, WorldStorage::Tiled),
+                [&] { return benchPheromoneDecay(size, PheromoneDecayMode::Eager, coverage, WorldStorage::Tiled, 100, seed); });
+        }
+    }
+
+    for (int size : { 256, 2048 }) {
+        for (PheromoneLayout layout : { PheromoneLayout::Separate, PheromoneLayout::Interleaved }) {
+            run(pheromoneLayoutName(layout, size, "sense"), [&] { return benchPheromoneLayout(layout, size, true, 2000000, seed); });
+            run(pheromoneLayoutName(layout, size, "decay"), [&] { return benchPheromoneLayout(layout, size, false, 100, seed); });
+        }
+    }
+
+    const unsigned long long KERNEL_DECISIONS = 2000000;
+    run("ant_kernel/followFoodPheromones", [&] {
+        return benchAntKernel("followFoodPheromones",
+            [](Ant& ant, const Colony& colony, const Environment& env) { ant.followFoodPheromones(colony, env); },
+            KERNEL_DECISIONS, seed);
+    });
+    run("ant_kernel/searchForFood", [&] {
+        AntIntents intents;
+        return benchAntKernel("searchForFood",
+            [&intents](Ant& ant, const Colony&, const Environment& env) {
+                intents.clear();
+                ant.searchForFood(intents, env);
+            },
+            KERNEL_DECISIONS, seed);
+    });
+    run("ant_kernel/wander", [&] {
+        return benchAntKernel("wander",
+            [](Ant& ant, const Colony&, const Environment& env) { ant.wander(env); },
+            KERNEL_DECISIONS, seed);
+    });
+
+    // The checksum is the same for every variant: all of them pick the same directions
+    for (const char* variant : { "legacy_vectors", "scalar", "sse", "avx2" }) {
+        if (std::string(variant) != "legacy_vectors" && std::string(variant) != "scalar") {
+            const DecisionKernels::Kernel kernel = std::string(variant) == "sse" ? DecisionKernels::Kernel::SSE : DecisionKernels::Kernel::AVX2;
+            if (!DecisionKernels::isSupported(kernel)) continue;
+        }
+        run(std::string("decision/weighted_pick/") + variant, [&] { return benchWeightedPick(variant, KERNEL_DECISIONS, seed); });
+    }
+
+    const unsigned long long renderSizes[] = { 10000, 100000, 1000000 };
+    for (unsigned long long ants : renderSizes) {
+        if (ants > config.maxAnts) continue;
+        run("render_prep/snapshot_capture/ants=" + std::to_string(ants), [&] { return benchSnapshotCapture(ants, 50, seed); });
+        run("render_prep/ant_vertices/ants=" + std::to_string(ants), [&] { return benchAntVertices(ants, 50, seed); });
+    }
+
+    if (config.outputPath.empty()) {
+        writeJson(std::cout, config, results);
+    }
+    else {
+        std::ofstream file(config.outputPath);
+        if (!file) {
+            std::cerr << "Error: cannot write " << config.outputPath << "\n";
+            return 1;
+        }
+        writeJson(file, config, results);
+        std::cerr << "Wrote " << results.size() << " results to " << config.outputPath << "\n";
+    }
+    return 0;
+}
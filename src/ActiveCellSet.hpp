@@ -0,0 +1,121 @@
+// AntSimulation - An SFML simulation of an ant colony.
+// Copyright (C) 2025 Logan Herrera <jherre36@live.nmhu.edu>
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#ifndef ACTIVE_CELL_SET_HPP
+#define ACTIVE_CELL_SET_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// Compact set of grid cells (by linear index): a dense list of members for fast iteration plus a
+// membership bitmap for O(1) insert/contains. Iteration order is insertion order, so anything driven
+// by it stays deterministic.
+// Single members can also be erased in O(1): the cell leaves the bitmap at once but its list entry stays
+// behind (skipped by forEach) until stale entries outnumber live ones and the list is compacted. A cell
+// inserted again while its old entry is still listed reuses that entry.
+class ActiveCellSet {
+public:
+    ActiveCellSet() = default;
+    explicit ActiveCellSet(size_t cellCount) : m_bits((cellCount + 63) / 64, 0), m_listed((cellCount + 63) / 64, 0) {}
+
+    bool contains(uint32_t cell) const {
+        return (m_bits[cell >> 6] >> (cell & 63)) & 1u;
+    }
+
+    // Returns true if the cell was not already a member
+    bool insert(uint32_t cell) {
+        uint64_t& word = m_bits[cell >> 6];
+        const uint64_t mask = uint64_t(1) << (cell & 63);
+        if (word & mask) {
+            return false;
+        }
+        word |= mask;
+        m_size++;
+        uint64_t& listed = m_listed[cell >> 6];
+        if (!(listed & mask)) {
+            listed |= mask;
+            m_cells.push_back(cell);
+        }
+        return true;
+    }
+
+    // cell must be a member
+    void erase(uint32_t cell) {
+        m_bits[cell >> 6] &= ~(uint64_t(1) << (cell & 63));
+        m_size--;
+        if (m_cells.size() - m_size > m_size + COMPACT_MIN_STALE) {
+            removeIf([](uint32_t) { return false; });
+        }
+    }
+
+    // Drops every member for which shouldRemove(cell) returns true, keeping the order of the rest
+    // (and compacts away the entries of erased cells)
+    template <typename Predicate>
+    void removeIf(Predicate shouldRemove) {
+        size_t kept = 0;
+        for (size_t i = 0; i < m_cells.size(); ++i) {
+            const uint32_t cell = m_cells[i];
+            const uint64_t mask = uint64_t(1) << (cell & 63);
+            if (!(m_bits[cell >> 6] & mask)) {
+                m_listed[cell >> 6] &= ~mask;
+            }
+            else if (shouldRemove(cell)) {
+                m_bits[cell >> 6] &= ~mask;
+                m_listed[cell >> 6] &= ~mask;
+                m_size--;
+            }
+            else {
+                m_cells[kept++] = cell;
+            }
+        }
+        m_cells.resize(kept);
+    }
+
+    void clear() {
+        for (uint32_t cell : m_cells) {
+            m_bits[cell >> 6] = 0;
+            m_listed[cell >> 6] = 0;
+        }
+        m_cells.clear();
+        m_size = 0;
+    }
+
+    // Calls visit(cell) for every member in insertion order
+    template <typename Visitor>
+    void forEach(Visitor visit) const {
+        for (uint32_t cell : m_cells) {
+            if (contains(cell)) {
+                visit(cell);
+            }
+        }
+    }
+
+    size_t size() const { return m_size; }
+    bool empty() const { return m_size == 0; }
+    size_t memoryBytes() const { return (m_bits.size() + m_listed.size()) * sizeof(uint64_t) + m_cells.size() * sizeof(uint32_t); }
+
+private:
+    // Stale entries tolerated on top of one per live member before erase compacts the list
+    static constexpr size_t COMPACT_MIN_STALE = 1024;
+
+    std::vector<uint32_t> m_cells; // Members plus not yet compacted entries of erased cells
+    std::vector<uint64_t> m_bits;   // Membership
+    std::vector<uint64_t> m_listed; // Cells that have an entry in m_cells
+    size_t m_size = 0;
+};
+
+#endif // ACTIVE_CELL_SET_HPP
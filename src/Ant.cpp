@@ -15,135 +15,72 @@
 // along with this program.  If not, see <https://www.gnu.org/licenses/>.
 #include "Ant.hpp"
 #include "Colony.hpp"
+#include "DecisionKernels.hpp"
+#include "Directions.hpp"
 #include "Environment.hpp"
 #include "RandomUtils.hpp"
 #include <iostream>
-#include <vector>
 #include <cmath>
-#include <random>
-#include <deque>
+#include <algorithm>
+
+// How followFoodPheromones weighs a neighbouring "to-food" trail (searching ants prefer paths away from home)
+static constexpr DecisionKernels::Rule FOOD_TRAIL_RULE = {
+    0.0f,   // minLevel: any trail at all
+    0.001f, // minWeight: slightly lower threshold for considering a path
+    0.5f,   // recentFactor: penalty for recently visited, was 0.1f, now less severe
+    0.2f,   // towardFactor: path leads TOWARDS home, penalize (was 0.1f)
+    1.2f,   // awayFactor: path leads AWAY from home, boost (was 1.5f)
+    1.1f    // diagonalFactor: diagonal move bonus
+};
+
+// How followHomePheromones weighs a neighbouring "to-home" trail (the opposite preference)
+static constexpr DecisionKernels::Rule HOME_TRAIL_RULE = {
+    0.001f, // minLevel
+    0.001f, // minWeight
+    0.5f,   // recentFactor (0.9f for a food-carrying ant right next to home)
+    2.0f,   // towardFactor
+    0.1f,   // awayFactor
+    1.1f    // diagonalFactor
+};
 
 // HOME PROXIMITY
 static constexpr float HOME_PROXIMITY_THRESHOLD = 8.0f; // Distance threshold for direct homing
 
-// generateRand: Generates a random integer between 0 and maxValue (inclusive)
-int Ant::generateRand(int maxValue) {
-    std::uniform_int_distribution<> distrib(0, maxValue);
-    return distrib(RandomUtils::getGenerator());
-}
-
-// Constructor
-Ant::Ant(int startX, int startY, int colonyX, int colonyY, float antCellSize, const sf::Color& colonyColor,
-    std::vector<std::vector<float>>& foodPheromones,
-    std::vector<std::vector<float>>& returnHomePheromones,
-    int colonyID,
-    const sf::Texture& antTexture)
-    : x(startX),
-    y(startY),
-    prevX(startX),
-    prevY(startY),
-    direction(Ant::generateRand(7)),
-    hasFood(false),
-    pheromoneStrength(100.0f),
+// Load constructor: copies the hot fields of ant 'index' out of the store
+Ant::Ant(AntStore& store, size_t index, int colonyX, int colonyY)
+    : x(store.x[index]),
+    y(store.y[index]),
+    prevX(store.prevX[index]),
+    prevY(store.prevY[index]),
+    direction(store.direction[index]),
+    hasFood(store.hasFood[index] != 0),
+    pheromoneStrength(store.pheromoneStrength[index]),
     homeX(colonyX),
     homeY(colonyY),
-    m_cellSize(antCellSize),
-    lifespan(MAX_LIFESPAN),
-    memoryLength(10),
-    movesWhileReturningHome(0),
-    m_colonyColor(colonyColor),
-    m_colonyID(colonyID),
-    m_foodPheromones(foodPheromones),
-    m_returnHomePheromones(returnHomePheromones)
+    lifespan(store.lifespan[index]),
+    m_id(store.id[index]),
+    m_rng(0, 0, 0, store.id[index], CounterRng::AntUpdate),
+    recentPositions(store.recentPositions[index]),
+    movesWhileReturningHome(store.movesWhileReturningHome[index])
 {
-    // --- Setup the Sprite ---
-    sprite.setTexture(antTexture); // Apply the texture
-
-    // To scale the sprite to the size of a cell, you need its original pixel dimensions
-    float textureWidth = static_cast<float>(antTexture.getSize().x);
-    float textureHeight = static_cast<float>(antTexture.getSize().y);
-
-    // Set the sprite's origin to its center for proper rotation and positioning
-    sprite.setOrigin(textureWidth / 2.f, textureHeight / 2.f);
-	// Define how big each ant sprite should be in the grid
-	float desiredAntSize = m_cellSize * 2.5f; // Adjust this factor as needed for visual clarity
-
-    // Scale the sprite to fit the cell size
-    // might want different scaling for X and Y?
-    sprite.setScale(m_cellSize / textureWidth, m_cellSize / textureHeight);
-
-    // Initial position and color
-    updateGraphics(); // This will set the sprite's initial position
-    sprite.setColor(m_colonyColor); // Use the base colony color initially
-
-    recentPositions.assign(1, std::make_pair(x, y));
 }
 
-// Manually defined move constructor was having trouble with unique_ptr and deque
-// needed to define it explicitly
-Ant::Ant(Ant&& other) noexcept
-    : x(other.x),
-    y(other.y),
-    prevX(other.prevX),
-    prevY(other.prevY),
-    direction(other.direction),
-    hasFood(other.hasFood),
-    pheromoneStrength(other.pheromoneStrength),
-    homeX(other.homeX),
-    homeY(other.homeY),
-    m_cellSize(other.m_cellSize),
-    lifespan(other.lifespan),
-    memoryLength(other.memoryLength),
-    movesWhileReturningHome(other.movesWhileReturningHome),
-    m_colonyColor(other.m_colonyColor),
-    m_colonyID(other.m_colonyID),
-    m_foodPheromones(other.m_foodPheromones),
-    m_returnHomePheromones(other.m_returnHomePheromones),
-    sprite(std::move(other.sprite)),
-    recentPositions(std::move(other.recentPositions))
-{
-}
-
-// Manually defined move assignment operator was having trouble with unique_ptr and deque
-// same as move constructor, but with assignment logic
-Ant& Ant::operator=(Ant&& other) noexcept {
-    if (this != &other) {
-        x = other.x;
-        y = other.y;
-        prevX = other.prevX;
-        prevY = other.prevY;
-        direction = other.direction;
-        hasFood = other.hasFood;
-        pheromoneStrength = other.pheromoneStrength;
-        homeX = other.homeX;
-        homeY = other.homeY;
-        m_cellSize = other.m_cellSize;
-        lifespan = other.lifespan;
-        memoryLength = other.memoryLength;
-        movesWhileReturningHome = other.movesWhileReturningHome;
-        m_colonyColor = other.m_colonyColor;
-        m_colonyID = other.m_colonyID;
-
-        // References cannot be reassigned. They must refer to the same object throughout their lifetime.
-        // Move the unique_ptr content
-        sprite = std::move(other.sprite);
-        // Move the deque content
-        recentPositions = std::move(other.recentPositions);
-
-        // Clear out the moved-from object's data where appropriate (optional, but good practice)
-		other.x = 0; other.y = 0; // Or other default values
-    }
-    return *this;
-}
-
-
-Ant::~Ant()
-{
-    // Destructor content if needed. unique_ptr will automatically delete the shape.
+void Ant::writeBack(AntStore& store, size_t index) const {
+    store.x[index] = x;
+    store.y[index] = y;
+    store.prevX[index] = prevX;
+    store.prevY[index] = prevY;
+    store.direction[index] = direction;
+    store.hasFood[index] = hasFood ? 1 : 0;
+    store.pheromoneStrength[index] = pheromoneStrength;
+    store.lifespan[index] = lifespan;
+    store.movesWhileReturningHome[index] = movesWhileReturningHome;
+    store.recentPositions[index] = recentPositions;
 }
 
 // Main update logic for the ant for a single turn
-void Ant::updateSelf(Environment& env, Colony& colony) {
+void Ant::updateSelf(const Environment& env, const Colony& colony, AntIntents& intents) {
+    m_rng = colony.antRandom(m_id);
 
     // Decrement lifespan at the start of each update cycle
     if (lifespan > 0) {
@@ -155,26 +92,26 @@ void Ant::updateSelf(Environment& env, Colony& colony) {
         bool atHome = (this->x == this->homeX && this->y == this->homeY);
 
         if (atHome) {
-			storeFood(colony); // This sets hasFood = false and resets movesWhileReturningHome counter
+			storeFood(intents); // This sets hasFood = false and resets movesWhileReturningHome counter
 			lifespan++; // Reset lifespan when returning home with food
         }
         else {
             // Not at home, but has food. Try to navigate home.
             int oldX = this->x;
             int oldY = this->y;
-            float distToHomeBeforeMove = std::sqrt(static_cast<float>(std::pow(this->x - this->homeX, 2) + std::pow(this->y - this->homeY, 2)));
+            float distToHomeBeforeMove = colony.homeField.distance(this->x, this->y);
 
             // --- Prioritize direct homing for food-carrying ants ---
             if (distToHomeBeforeMove <= HOME_PROXIMITY_THRESHOLD) { // If very close, force direct homing
-                goHome(colony, env);
+                goHome(intents, env, colony);
             }
             else if (this->movesWhileReturningHome < MAX_TOTAL_RETURN_ATTEMPTS) { // Use MAX_TOTAL_RETURN_ATTEMPTS as the limit for direct goHome attempts
-                goHome(colony, env);
+                goHome(intents, env, colony);
             }
             else {
                 // This is the fallback for when an ant has been trying to go home for an extremely long time
                 // (exceeding MAX_TOTAL_RETURN_ATTEMPTS), suggesting it's genuinely stuck or off-map.
-                direction = Ant::generateRand(7); // Allow random wander if truly lost
+                direction = generateRand(7); // Allow random wander if truly lost
                 move(env);
             }
 
@@ -185,7 +122,7 @@ void Ant::updateSelf(Environment& env, Colony& colony) {
 
             // Sanity Check:
             bool movedToNewCell = (this->x != oldX || this->y != oldY);
-            float distToHomeAfterMove = std::sqrt(static_cast<float>(std::pow(this->x - this->homeX, 2) + std::pow(this->y - this->homeY, 2)));
+            float distToHomeAfterMove = colony.homeField.distance(this->x, this->y);
 
             // If it didn't move OR didn't make progress towards home (and not already in direct homing zone)
             if ((!movedToNewCell || distToHomeAfterMove >= distToHomeBeforeMove - 0.1f) &&
@@ -195,76 +132,54 @@ void Ant::updateSelf(Environment& env, Colony& colony) {
 
             // After attempting to move, check again if now at home
             if (this->x == this->homeX && this->y == this->homeY) {
-                storeFood(colony);
+                storeFood(intents);
             }
             // Only deposit food pheromones if not in the "truly lost" wandering phase
             else if (hasFood && this->movesWhileReturningHome < MAX_TOTAL_RETURN_ATTEMPTS) {
-                depositFoodPheromones(env);
+                depositFoodPheromones(intents);
             }
         }
     }
     else { // Ant does not have food - searching
         // Special behavior for ants that just dropped off food
         if (this->movesWhileReturningHome == 0 && this->prevX == this->homeX && this->prevY == this->homeY) {
-            if (Ant::generateRand(99) < 3) { // 3% chance to wander
+            if (generateRand(99) < 3) { // 3% chance to wander
                 wander(env); // Explore randomly
             }
             else { // 95% chance to follow food trails
-                followFoodPheromones(env); // Directly try to follow food trails
+                followFoodPheromones(colony, env); // Directly try to follow food trails
             }
             // An ant leaving the nest, regardless of its path, always drops home pheromones
-            depositHomePheromones(env);
+            depositHomePheromones(intents);
         }
         else { // Normal searching behavior for ants that have been out for a while
-            searchForFood(env);
-            if (!hasFood) {
-                depositHomePheromones(env); // Drop the To Home Pheromone exploration trail
-                followFoodPheromones(env); // This will wander if no food trails are found
-            }
-            else { // Food was just found by searchForFood()!
-                this->pheromoneStrength = 20.0f;
-                depositFoodPheromones(env);
-                this->movesWhileReturningHome = 0;
+            // Food found: the ant waits for its claim. If another ant takes the last unit first, this one stays
+            // exactly as it was (no move, no trail to food that is gone) and searches again next tick.
+            if (!searchForFood(intents, env)) {
+                depositHomePheromones(intents); // Drop the To Home Pheromone exploration trail
+                followFoodPheromones(colony, env); // This will wander if no food trails are found
             }
         }
     }
 }
 
 // Movement Logic: Ant moves one step based on its current direction (8 directions)
-void Ant::move(Environment& env) {
+void Ant::move(const Environment& env) {
     //set previous positions before moving
     this->prevX = this->x;
     this->prevY = this->y;
 
-    //direction to move
-    switch (direction) {
-    case 0: y -= 1; break;             // North
-    case 1: x += 1; y -= 1; break;    // Northeast
-    case 2: x += 1; break;             // East
-    case 3: x += 1; y += 1; break;    // Southeast
-    case 4: y += 1; break;             // South
-    case 5: x -= 1; y += 1; break;    // Southwest
-    case 6: x -= 1; break;             // West
-    case 7: x -= 1; y -= 1; break;    // Northwest
-    }
+    //boundary check: one table lookup tells whether this direction leaves the world
+    const bool hitBoundary = !((Directions::insideMask(x, y, env.width, env.height) >> direction) & 1u);
 
-    //boundary check
-    bool hitBoundary = false;
-    if (this->x < 0) {
-        this->x = 0;
-        hitBoundary = true;
-    }
-    else if (this->x >= Environment::GRID_SIZE) {
-        this->x = Environment::GRID_SIZE - 1;
-        hitBoundary = true;
-    }
-    if (this->y < 0) {
-        this->y = 0;
-        hitBoundary = true;
-    }
-    else if (this->y >= Environment::GRID_SIZE) {
-        this->y = Environment::GRID_SIZE - 1;
-        hitBoundary = true;
+    //direction to move (N, NE, E, SE, S, SW, W, NW)
+    x += Directions::DX[direction];
+    y += Directions::DY[direction];
+
+    // Stepping off an edge leaves the ant on the edge cell, exactly as before
+    if (hitBoundary) {
+        x = std::min(std::max(x, 0), env.width - 1);
+        y = std::min(std::max(y, 0), env.height - 1);
     }
 
     // When a boundary is hit, force a significant turn.
@@ -284,47 +199,34 @@ void Ant::move(Environment& env) {
         }
     }
 
-    // Reflect the movement changes graphically
-    updateGraphics();
-
     // Update recent positions ants short term memory
-    recentPositions.push_back(std::make_pair(x, y));
-    if (recentPositions.size() > memoryLength) {
-        recentPositions.pop_front(); // O(1) pop_front
-    }
+    recentPositions.push(x, y); // Forgets the oldest position once MEMORY_LENGTH are remembered
 }
 
 // Wander function for 8 directions
-void Ant::wander(Environment& env) {
-    const int dx[] = { 0, 1, 1, 1, 0, -1, -1, -1 }; // N, NE, E, SE, S, SW, W, NW
-    const int dy[] = { -1, -1, 0, 1, 1, 1, 0, -1 };
-
+void Ant::wander(const Environment& env) {
     bool decidedToContinueCurrentDir = false;
+    // Which of the 8 neighbours are in short term memory ('remembering' where it's previously been)
+    const unsigned recentlyVisitedMask = recentPositions.neighborMask(x, y);
+    // Neighbours inside the world, and the one the ant just came from
+    const unsigned insideMask = Directions::insideMask(x, y, env.width, env.height);
+    const unsigned previousCellMask = Directions::directionBit(x, y, prevX, prevY);
 
     // --- Start of Directional Inertia Logic (70% chance to try) ---
     if (generateRand(100) < 70) {
         int currentDir = this->direction; // The direction the ant is already facing
-        int nextX = this->x + dx[currentDir];
-        int nextY = this->y + dy[currentDir];
 
         bool canContinue = true;
 
         // Check if continuing in the current direction is valid
-        if (nextX < 0 || nextX >= Environment::GRID_SIZE ||
-            nextY < 0 || nextY >= Environment::GRID_SIZE) {
+        if (!(insideMask & (1u << currentDir))) {
             canContinue = false; // Would hit a boundary
         }
-        else if (nextX == this->prevX && nextY == this->prevY) {
+        else if (previousCellMask & (1u << currentDir)) {
             canContinue = false; // Would be going directly back
         }
-        else {
-            // Check short-term memory
-            for (const auto& pos : recentPositions) {
-                if (pos.first == nextX && pos.second == nextY) { // 'Remembering' where it's previously been
-                    canContinue = false; // Would be a recently visited spot
-                    break;
-                }
-            }
+        else if (recentlyVisitedMask & (1u << currentDir)) { // Check short-term memory
+            canContinue = false; // Would be a recently visited spot
         }
 
         if (canContinue) {
@@ -339,40 +241,12 @@ void Ant::wander(Environment& env) {
     // If the ant didn't decide to continue its current path (either by chance or because it was bad)
     // then use the existing logic to find a new good direction.
     if (!decidedToContinueCurrentDir) {
-        std::vector<int> potentialGoodDirections;
-
-        for (int i = 0; i < 8; ++i) {
-            int testDir = i;
-
-            int neighborX = this->x + dx[testDir];
-            int neighborY = this->y + dy[testDir];
-
-            //check within bounds
-            if (neighborX < 0 || neighborX >= Environment::GRID_SIZE ||
-                neighborY < 0 || neighborY >= Environment::GRID_SIZE) {
-                continue;
-            }
-            // check previous x,y
-            if (neighborX == this->prevX && neighborY == this->prevY) {
-                continue;
-            }
-
-            bool wasRecentlyVisited = false;
-            //check short term memory
-            for (const auto& pos : recentPositions) {
-                if (pos.first == neighborX && pos.second == neighborY) {
-                    wasRecentlyVisited = true;
-                    break;
-                }
-            }
-            // if ant has not been there before add direction to potential 'good' directions vector
-            if (!wasRecentlyVisited) {
-                potentialGoodDirections.push_back(testDir);
-            }
-        }
-        // if the good directions vector is not empty pick randomly from the good directions vector
-        if (!potentialGoodDirections.empty()) {
-            this->direction = potentialGoodDirections[generateRand(potentialGoodDirections.size() - 1)];
+        // 'Good' directions stay within bounds, do not lead back to the previous x,y and are not in short term memory
+        const unsigned potentialGoodDirections = insideMask & ~previousCellMask & ~recentlyVisitedMask;
+        const int goodDirectionCount = DecisionKernels::count(potentialGoodDirections);
+        // if there are good directions pick one of them at random
+        if (goodDirectionCount > 0) {
+            this->direction = DecisionKernels::nth(potentialGoodDirections, generateRand(goodDirectionCount - 1));
         }
         else {
             // All neighbors are either previous cell or recently visited or out of bounds.
@@ -385,44 +259,45 @@ void Ant::wander(Environment& env) {
 }
 
 // Food Search Logic: Ant checks current cell and 8 surrounding cells for food
-void Ant::searchForFood(Environment& env) {
-    if (env.checkForFood(x, y)) { // check current cell for food has food when env.checkForFood returns true
-        hasFood = true; // set hasFood to true
-        env.removeFood(x, y); // remove the food source from the environment because the ant picked it up
-        sprite.setColor(sf::Color::Green); // Ants with food turn Green colored when returning home
-        return;
+bool Ant::searchForFood(AntIntents& intents, const Environment& env) {
+    // One query covers the current cell and all 8 neighbours; most searching ants see no food at all
+    const unsigned int around = env.foodAround(x, y);
+    if (around == 0) {
+        return false;
     }
 
-    const int dx[] = { 0, 1, 1, 1, 0, -1, -1, -1 }; // N, NE, E, SE, S, SW, W, NW
-    const int dy[] = { -1, -1, 0, 1, 1, 1, 0, -1 };
+    if (around & Environment::foodAroundBit(0, 0)) { // the current cell has food
+        intents.foodClaims.push_back({ x, y, intents.antIndex }); // the colony hands out the food once every ant has moved
+        return true;
+    }
 
     // check the 8 directions around the ant for food
     for (int i = 0; i < 8; ++i) {
-        int checkX = this->x + dx[i];
-        int checkY = this->y + dy[i];
-
-        if (checkX < 0 || checkX >= Environment::GRID_SIZE || checkY < 0 || checkY >= Environment::GRID_SIZE) {
-            continue;
-        }
-
-        if (env.checkForFood(checkX, checkY)) {
-            this->prevX = this->x; // Store current before moving
-            this->prevY = this->y;
-            this->x = checkX;      // Move to adjacent food cell
-            this->y = checkY;
-            hasFood = true; // cell checkX,checkY has food set to true
-            env.removeFood(checkX, checkY);
-            sprite.setColor(sf::Color::Green); // Turn ant green since it has food
-            updateGraphics(); // Reflect changes graphically
-            return;
+        if (around & Environment::foodAroundBit(Directions::DX[i], Directions::DY[i])) { // Cells outside the world never have their bit set
+            intents.foodClaims.push_back({ this->x + Directions::DX[i], this->y + Directions::DY[i], intents.antIndex });
+            return true;
         }
     }
+    return false;
+}
+
+void Ant::takeFood(int foodX, int foodY, AntIntents& intents) {
+    if (foodX != this->x || foodY != this->y) {
+        this->prevX = this->x; // Store current before moving
+        this->prevY = this->y;
+        this->x = foodX;       // Move to adjacent food cell
+        this->y = foodY;
+    }
+    hasFood = true;
+    this->pheromoneStrength = 20.0f;
+    depositFoodPheromones(intents);
+    this->movesWhileReturningHome = 0;
 }
 
 // Pheromone Following for searching ants (!hasFood)
-void Ant::followFoodPheromones(Environment& env) { // This is called ONLY when ant does not have food by updateSelf
+void Ant::followFoodPheromones(const Colony& colony, const Environment& env) { // This is called ONLY when ant does not have food by updateSelf
     // Get "to-food" pheromone level at current ant's cell
-    float currentPheromoneOnCell = m_foodPheromones[x][y];
+    float currentPheromoneOnCell = colony.getFoodPheromoneLevel(x, y);
 
     // If on a very strong "to-food" pheromone spot, small chance to explore locally (wander)
     // This helps prevent ants from clustering too much right on the trail at the end if food is nearby.
@@ -431,116 +306,40 @@ void Ant::followFoodPheromones(Environment& env) { // This is called ONLY when a
         return;
     }
 
-    const int dx[] = { 0, 1, 1, 1, 0, -1, -1, -1 }; // N, NE, E, SE, S, SW, W, NW
-    const int dy[] = { -1, -1, 0, 1, 1, 1, 0, -1 };
-
-    std::vector<float> candidatePheromonesWeights;
-    std::vector<int> candidateDirections; // Stores the direction enum (0-7)
-    float totalWeightSum = 0.0f;
-
     // Using Euclidean distance for home (though Manhattan was used before when I only used 4 directions, sqrt is more accurate for 8 directions diagonal bias)
-    float currentDistToHome = std::sqrt(static_cast<float>(std::pow(this->x - this->homeX, 2) + std::pow(this->y - this->homeY, 2)));
-
-    for (int i = 0; i < 8; ++i) { // Check all 8 directions
-        int potentialNewDir = i;
-        int neighborX = this->x + dx[i];
-        int neighborY = this->y + dy[i];
-
-        if (neighborX < 0 || neighborX >= Environment::GRID_SIZE ||
-            neighborY < 0 || neighborY >= Environment::GRID_SIZE) {
-            continue;
-        }
-        if (neighborX == this->prevX && neighborY == this->prevY) {
-            continue;
-        }
-
-        bool wasRecentlyVisited = false;
-        // short term memory
-        for (const auto& pos : recentPositions) {
-            if (pos.first == neighborX && pos.second == neighborY) {
-                wasRecentlyVisited = true;
-                break;
-            }
-        }
-
-        // Get the pheromone level from colony's grid
-        float pheromoneLevel = m_foodPheromones[neighborX][neighborY];
-
-        if (pheromoneLevel > 0) {
-            float weight = pheromoneLevel;
-
-            if (wasRecentlyVisited) {
-                weight *= 0.5f; // Penalty for recently visited, was 0.1f, now less severe
-            }
-
-            // Logic for searching ants without food (!hasFood) to prefer paths away from home
-            float neighborDistToHome = std::sqrt(static_cast<float>(std::pow(neighborX - this->homeX, 2) + std::pow(neighborY - this->homeY, 2)));
-            if (neighborDistToHome < currentDistToHome) { // Path leads TOWARDS home
-                weight *= 0.2f; // Penalize, was 0.1f
-            }
-            else if (neighborDistToHome > currentDistToHome) { // Path leads AWAY from home
-                weight *= 1.2f; // Boost, was 1.5f
-            }
-
-            // Diagonal move bonus (directions 1, 3, 5, 7 are diagonal)
-            if (potentialNewDir % 2 != 0) {
-                weight *= 1.1f;
-            }
-
-            if (weight > 0.001f) { // Slightly lower threshold for considering a path
-                candidatePheromonesWeights.push_back(weight);
-                candidateDirections.push_back(potentialNewDir);
-                totalWeightSum += weight;
-            }
-        }
-    }
-
-    if (candidateDirections.empty() || (totalWeightSum <= 0.1f && generateRand(100) < 20)) { // lower sum threshold, lower wander chance
+    // Distances come from the colony's precomputed home field
+    DecisionKernels::Lanes lanes;
+    lanes.currentDistance = colony.homeField.distance(this->x, this->y);
+    colony.homeField.gatherDistances(this->x, this->y, lanes.distances);
+    // Neighbours off the map or back where the ant came from are never candidates
+    lanes.candidates = Directions::insideMask(x, y, env.width, env.height) & ~Directions::directionBit(x, y, prevX, prevY);
+    lanes.recent = recentPositions.neighborMask(x, y); // Bit i: neighbour i is in short term memory
+    // All 8 neighbouring pheromone levels from the colony's grid in one gather
+    colony.getFoodPheromoneNeighbors(x, y, lanes.levels);
+
+    // Weigh all 8 directions at once (see FOOD_TRAIL_RULE); rejected directions get weight 0
+    float weights[Directions::COUNT];
+    const unsigned candidates = DecisionKernels::weigh(lanes, FOOD_TRAIL_RULE, weights);
+    const float totalWeightSum = DecisionKernels::total(weights);
+
+    if (candidates == 0 || (totalWeightSum <= 0.1f && generateRand(100) < 20)) { // lower sum threshold, lower wander chance
         wander(env);
     }
     else {
-        std::uniform_real_distribution<float> distrib(0.0f, totalWeightSum);
-        float randomPick = distrib(RandomUtils::getGenerator());
-        float currentSum = 0.0f;
-        int chosenDir = -1;
-
-        for (size_t j = 0; j < candidatePheromonesWeights.size(); ++j) {
-            currentSum += candidatePheromonesWeights[j];
-            if (randomPick <= currentSum) {
-                chosenDir = candidateDirections[j];
-                break;
-            }
-        }
-
-        if (chosenDir == -1 && !candidateDirections.empty()) { // Fallback logic
-            float maxW = 0.0f;
-            int bestDir = candidateDirections[0];
-            for (size_t k = 0; k < candidateDirections.size(); ++k) {
-                if (candidatePheromonesWeights[k] > maxW) {
-                    maxW = candidatePheromonesWeights[k];
-                    bestDir = candidateDirections[k];
-                }
-            }
-            chosenDir = bestDir;
-        }
-
-        if (chosenDir != -1) {
-            this->direction = chosenDir;
-            move(env);
-        }
-        else { //if nothing else works, wander
-            wander(env);
+        float randomPick = m_rng.uniform(0.0f, totalWeightSum);
+        int chosenDir = DecisionKernels::pick(weights, candidates, randomPick);
+        if (chosenDir == -1) { // Fallback logic: rounding left randomPick above every running sum
+            chosenDir = DecisionKernels::heaviest(weights, candidates);
         }
+        this->direction = chosenDir;
+        move(env);
     }
 }
 
 
 // Pheromone Following for ants trying to follow the go home trail (hasFood) or lost
 // Basically does the opposite of followFoodPheromones, but with "to-home" pheromones
-bool Ant::followHomePheromones(Environment& env) {
-    const int dx[] = { 0, 1, 1, 1, 0, -1, -1, -1 }; // N, NE, E, SE, S, SW, W, NW
-    const int dy[] = { -1, -1, 0, 1, 1, 1, 0, -1 };
-
+bool Ant::followHomePheromones(const Colony& colony, const Environment& env) {
     // --- START: PRIORITY GEOMETRIC HOMING for food-carrying ants ---
     if (this->hasFood) {
         // Check if the ant is directly adjacent (includes diagonals) to its home cell,
@@ -550,17 +349,10 @@ bool Ant::followHomePheromones(Environment& env) {
             !(this->x == this->homeX && this->y == this->homeY);
 
         if (isAdjacentToHome) {
-            for (int i = 0; i < 8; ++i) { // Check all 8 potential directions
-                int neighborX = this->x + dx[i];
-                int neighborY = this->y + dy[i];
-
-                if (neighborX == this->homeX && neighborY == this->homeY) {
-                    // This direction 'i' leads straight to the home cell.
-                    this->direction = i;
-                    move(env);
-                    return true; // Successfully made a direct move to home
-                }
-            }
+            // Next to home, the field's step toward home leads straight onto the home cell
+            this->direction = colony.homeField.homeDirection(this->x, this->y);
+            move(env);
+            return true; // Successfully made a direct move to home
         }
     }
     // --- END: REFINED PRIORITY GEOMETRIC HOMING ---
@@ -568,57 +360,27 @@ bool Ant::followHomePheromones(Environment& env) {
     // If geometric homing didn't apply (not adjacent) or didn't result in a move,
     // or if ant does not have food !hasFood, proceed with standard pheromone evaluation:
 
-    float currentHomePheromoneOnCell = m_returnHomePheromones[x][y];
+    float currentHomePheromoneOnCell = colony.getReturnHomePheromoneLevel(x, y);
     if (!this->hasFood && currentHomePheromoneOnCell > 30.0f && generateRand(100) < 5) {
         wander(env);
         return false;
     }
 
-    std::vector<float> candidatePheromonesWeights;
-    std::vector<int> candidateDirections;
-    float totalWeightSum = 0.0f;
-    float currentDistToHome = std::sqrt(static_cast<float>(std::pow(this->x - this->homeX, 2) + std::pow(this->y - this->homeY, 2)));
+    DecisionKernels::Lanes lanes;
+    lanes.currentDistance = colony.homeField.distance(this->x, this->y);
+    colony.homeField.gatherDistances(this->x, this->y, lanes.distances);
+    lanes.candidates = Directions::insideMask(x, y, env.width, env.height) & ~Directions::directionBit(x, y, prevX, prevY);
+    lanes.recent = recentPositions.neighborMask(x, y);
+    colony.getReturnHomePheromoneNeighbors(x, y, lanes.levels); //Get pheromone levels from colony grid
 
-    for (int i = 0; i < 8; ++i) {
-        int potentialNewDir = i;
-        int neighborX = this->x + dx[i];
-        int neighborY = this->y + dy[i];
-
-        if (neighborX < 0 || neighborX >= Environment::GRID_SIZE || neighborY < 0 || neighborY >= Environment::GRID_SIZE) continue;
-        if (neighborX == this->prevX && neighborY == this->prevY) continue;
-
-        bool wasRecentlyVisited = false;
-        for (const auto& pos : recentPositions) {
-            if (pos.first == neighborX && pos.second == neighborY) {
-                wasRecentlyVisited = true;
-                break;
-            }
-        }
-        //Get pheromone level from colony grid
-        float pheromoneLevel = m_returnHomePheromones[neighborX][neighborY];
-        if (pheromoneLevel > 0.001f) {
-            float weight = pheromoneLevel;
-            if (wasRecentlyVisited) {
-                // Adaptive penalty for recently visited still applies if not taking the geometric step
-                if (this->hasFood && currentDistToHome < 2.5f) weight *= 0.9f;
-                else weight *= 0.5f;
-            }
-            float neighborDistToHome = std::sqrt(static_cast<float>(std::pow(neighborX - this->homeX, 2) + std::pow(neighborY - this->homeY, 2)));
-            if (neighborDistToHome < currentDistToHome) weight *= 2.0f;
-            else if (neighborDistToHome > currentDistToHome) weight *= 0.1f;
-            if (potentialNewDir % 2 != 0) weight *= 1.1f;
-
-            if (weight > 0.001f) {
-                candidatePheromonesWeights.push_back(weight);
-                candidateDirections.push_back(potentialNewDir);
-                totalWeightSum += weight;
-            }
-        }
-    }
+    DecisionKernels::Rule rule = HOME_TRAIL_RULE;
+    // Adaptive penalty for recently visited still applies if not taking the geometric step
+    if (this->hasFood && lanes.currentDistance < 2.5f) rule.recentFactor = 0.9f;
+    float weights[Directions::COUNT];
+    const unsigned candidates = DecisionKernels::weigh(lanes, rule, weights);
+    const float totalWeightSum = DecisionKernels::total(weights);
 
-    int chosenDir = -1;
-
-    if (candidateDirections.empty()) {
+    if (candidates == 0) {
         if (!this->hasFood) {
             wander(env);
         }
@@ -630,140 +392,70 @@ bool Ant::followHomePheromones(Environment& env) {
         return false;
     }
 
+    int chosenDir = -1;
     if (this->hasFood) {
-        float maxW = -1.0f;
-        for (size_t k = 0; k < candidateDirections.size(); ++k) {
-            if (candidatePheromonesWeights[k] > maxW) {
-                maxW = candidatePheromonesWeights[k];
-                chosenDir = candidateDirections[k];
-            }
-        }
-        if (chosenDir == -1 && !candidateDirections.empty()) {
-            chosenDir = candidateDirections[0];
-        }
+        chosenDir = DecisionKernels::heaviest(weights, candidates); // Carrying food: take the strongest trail
     }
     else {
-        std::uniform_real_distribution<float> distrib(0.0f, totalWeightSum);
-        float randomPick = distrib(RandomUtils::getGenerator());
-        float currentSum = 0.0f;
-        for (size_t j = 0; j < candidatePheromonesWeights.size(); ++j) {
-            currentSum += candidatePheromonesWeights[j];
-            if (randomPick <= currentSum) {
-                chosenDir = candidateDirections[j];
-                break;
-            }
-        }
-        if (chosenDir == -1 && !candidateDirections.empty()) {
-            float maxW = 0.0f; int bestDir = candidateDirections[0];
-            for (size_t k = 0; k < candidateDirections.size(); ++k) {
-                if (candidatePheromonesWeights[k] > maxW) {
-                    maxW = candidatePheromonesWeights[k]; bestDir = candidateDirections[k];
-                }
-            }
-            chosenDir = bestDir;
+        float randomPick = m_rng.uniform(0.0f, totalWeightSum);
+        chosenDir = DecisionKernels::pick(weights, candidates, randomPick);
+        if (chosenDir == -1) {
+            chosenDir = DecisionKernels::heaviest(weights, candidates);
         }
     }
 
-    if (chosenDir != -1) {
-        this->direction = chosenDir;
-        move(env);
-        return true;
-    }
-    else {
-        if (!this->hasFood) {
-            wander(env);
-        }
-        return false;
-    }
+    this->direction = chosenDir;
+    move(env);
+    return true;
 }
 
 // Storing Food in Colony
-void Ant::storeFood(Colony& colony) {
+void Ant::storeFood(AntIntents& intents) {
     hasFood = false;
     pheromoneStrength += 10.0f; // Replenish pheromone charge
-    sprite.setColor(m_colonyColor);
-    colony.addFood(1);
+    intents.foodDelivered++;
 }
 
 // Improved goHome function to use 8 directions, takes Environment for move()
-void Ant::goHome(Colony& colony, Environment& env) {
-    int targetX = homeX;
-    int targetY = homeY;
-
-    int deltaX = targetX - x;
-    int deltaY = targetY - y;
-
-    // Determine the best direction using 8 directions
-    if (deltaX == 0 && deltaY == 0) { // Already home
-        if (hasFood) storeFood(colony);
+// The step toward home for every cell near the nest is precomputed in the colony's home field
+void Ant::goHome(AntIntents& intents, const Environment& env, const Colony& colony) {
+    const int homeDirection = colony.homeField.homeDirection(x, y);
+    if (homeDirection == HomeField::AT_HOME) { // Already home
+        if (hasFood) storeFood(intents);
         return;
     }
-
-    // Simplified direction setting towards target
-    if (deltaX > 0) { // Need to move East, SE, or NE
-        if (deltaY > 0) direction = 3;      // Southeast
-        else if (deltaY < 0) direction = 1; // Northeast
-        else direction = 2;                 // East
-    }
-    else if (deltaX < 0) { // Need to move West, SW, or NW
-        if (deltaY > 0) direction = 5;      // Southwest
-        else if (deltaY < 0) direction = 7; // Northwest
-        else direction = 6;                 // West
-    }
-    else { // deltaX is 0, so N or S
-        if (deltaY > 0) direction = 4;      // South
-        else direction = 0;                 // North (deltaY must be < 0 if not 0,0)
-    }
+    direction = homeDirection;
 
     move(env); // This also updates prevX, prevY
 
     // Check if arrived home at the colony after moving
     if (x == homeX && y == homeY && hasFood) {
-        storeFood(colony);
+        storeFood(intents);
     }
 }
 
 // Deposit Food Pheromones into the Environment
-void Ant::depositFoodPheromones(Environment& env) {
+void Ant::depositFoodPheromones(AntIntents& intents) {
     if (this->hasFood && this->pheromoneStrength > 0.05f) { // Lower threshold slightly
 		float amountToDeposit = 60.0f; // Amount of food Pheromones to drop
-        // Use colony's specific pheromone grid
-        m_foodPheromones[x][y] += amountToDeposit;
-        if (m_foodPheromones[x][y] > Colony::MAX_PHEROMONE_LEVEL) {
-            m_foodPheromones[x][y] = Colony::MAX_PHEROMONE_LEVEL;
-        }
+        // Applied to the colony's food trail (clamped to MAX_PHEROMONE_LEVEL) after the tick
+        intents.foodDeposits.push_back({ x, y, amountToDeposit });
         this->pheromoneStrength -= 0.1f; // CRITICAL: Reduced from 0.5f to 0.1f to match home pheromones
         if (this->pheromoneStrength < 0.0f) this->pheromoneStrength = 0.0f;
     }
 }
 
 // Deposit Home Pheromones into the Environment
-void Ant::depositHomePheromones(Environment& env) {
+void Ant::depositHomePheromones(AntIntents& intents) {
     if (!this->hasFood && this->pheromoneStrength > 0.1f) {
         float amountToDeposit = 50.5f; // Amount of home Pheromones to drop
-        // Use colony's specific pheromone grid
-        m_returnHomePheromones[x][y] += amountToDeposit;
-        if (m_returnHomePheromones[x][y] > Colony::MAX_PHEROMONE_LEVEL) {
-            m_returnHomePheromones[x][y] = Colony::MAX_PHEROMONE_LEVEL;
-        }
+        // Applied to the colony's home trail (clamped to MAX_PHEROMONE_LEVEL) after the tick
+        intents.homeDeposits.push_back({ x, y, amountToDeposit });
         this->pheromoneStrength -= 0.1f;
         if (this->pheromoneStrength < 0.0f) this->pheromoneStrength = 0.0f;
     }
 }
 
-// Update SFML Graphics to reflect the ant's current grid position
-void Ant::updateGraphics() {
-    // We position the sprite by its center, so we calculate the center of the grid cell
-    float cellCenterX = (static_cast<float>(x) + 0.5f) * m_cellSize;
-    float cellCenterY = (static_cast<float>(y) + 0.5f) * m_cellSize;
-    sprite.setPosition(cellCenterX, cellCenterY);
-
-    // Optional: Rotate the sprite to match the ant's direction
-    // 0 is North (pointing up, which is -90 degrees in SFML)
-    // and ant image points to the right (0 degrees) by default.
-    sprite.setRotation(static_cast<float>(direction) * 45.f);
-}
-
 // Lifespan & Combat future features
 bool Ant::isDead() const {
     return lifespan <= 0;
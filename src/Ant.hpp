@@ -17,17 +17,17 @@
 #ifndef ANT_HPP
 #define ANT_HPP
 
+#include "AntIntents.hpp"
+#include "AntStore.hpp"
 #include "Environment.hpp"
-#include <SFML/Graphics.hpp>
 #include "RandomUtils.hpp"
-#include <utility>
-#include <deque>
-#include <memory>
 #include <vector>
 
 // Forward declarations
 class Colony;
 
+// Working copy of one ant while it decides what to do this tick.
+// The ant itself lives in its colony's AntStore; Colony loads it, runs updateSelf and writes it back.
 class Ant {
 public:
     // Position & State (Grid coordinates)
@@ -40,9 +40,6 @@ public:
     // Colony Coordinates
     int homeX, homeY;
 
-    // SFML Shape for Rendering Ant
-    sf::Sprite sprite;
-
     // Lifespan
     int lifespan;
     static const int MAX_LIFESPAN = 1000;
@@ -53,58 +50,44 @@ public:
     static const int MAX_PHEROMONE_RETURN_ATTEMPTS = 10;
     static const int MAX_TOTAL_RETURN_ATTEMPTS = 150;
     static constexpr float HOME_PROXIMITY_THRESHOLD = 8.0f; 
+    static constexpr size_t MEMORY_LENGTH = AntStore::MEMORY_LENGTH; // Length of the ants short term memory for recent positions
+    static constexpr float INITIAL_PHEROMONE_STRENGTH = 100.0f;
 
-    sf::Color getColonyColor() const {
-        return m_colonyColor; 
-    }
-
-    int getColonyID() const { 
-        return m_colonyID;
+    // Unique within the colony; together with the colony ID and tick it keys the ant's random stream
+    unsigned int getID() const {
+        return m_id;
     }
     // future feature getAntType()
     // future feature getHealth()
     // future feature getAttackDamage()
 
-	// No longer managing unique_ptr for shape directly in Ant class.
-    // --- CRITICAL: Manually define move constructor and move assignment operator ---
-     // This removes any ambiguity and forces the compiler to use these specific implementations.
-	// This is necessary because Ant contains a std::unique_ptr, which cannot be copied but can be moved.
-	// If you do not define these, the compiler will generate default move operations that may not work as intended.
-	// I ran into issues with the default move constructor and assignment operator not working correctly
-    Ant(Ant&& other) noexcept; // Manually defined move constructor
-    Ant& operator=(Ant&& other) noexcept; // Manually defined move assignment operator
-
-    // Copy constructor and copy assignment operator implicitly deleted (due to unique_ptr),
-    // or explicitly deleted by: Ant(const Ant&) = delete; Ant& operator=(const Ant&) = delete; 
+    // Loads ant 'index' from the store
+    Ant(AntStore& store, size_t index, int colonyX, int colonyY);
 
-    // Constructor
-    Ant(int startX, int startY, int colonyX, int colonyY, float antCellSize, const sf::Color& colonyColor,
-        std::vector<std::vector<float>>(&foodPheromones), // Reference to colony's food pheromone grid
-        std::vector<std::vector<float>>(&returnHomePheromones),// Reference to colony's home pheromone grid
-        int colonyID,
-        const sf::Texture& antTexture);
-
-
-    // Destructor
-    ~Ant();
+    // Copies the updated state back to slot 'index' of the store
+    void writeBack(AntStore& store, size_t index) const;
 
     // Movement & Behavior
-    void move(Environment& env);
-    void wander(Environment& env);
-    void searchForFood(Environment& env);
-    void goHome(Colony& colony, Environment& env);
-    void storeFood(Colony& colony);
-
-    void updateSelf(Environment& env, Colony& colony);
+    // The ant only changes itself; food pickups, deliveries and pheromone deposits are recorded in
+    // intents and applied by the colony once every ant has decided (see Colony::applyIntents)
+    void move(const Environment& env);
+    void wander(const Environment& env);
+    // Claims the first cell with food among the current cell and its 8 neighbours without changing the ant;
+    // returns true if it made a claim. The pickup itself (takeFood) only happens if the colony grants it.
+    bool searchForFood(AntIntents& intents, const Environment& env);
+    // A granted claim: step onto the food cell if it is a neighbour, pick the food up and start the food trail
+    void takeFood(int foodX, int foodY, AntIntents& intents);
+    void goHome(AntIntents& intents, const Environment& env, const Colony& colony);
+    void storeFood(AntIntents& intents);
+
+    void updateSelf(const Environment& env, const Colony& colony, AntIntents& intents);
 
     // Pheromone Interaction
-    void depositFoodPheromones(Environment& env);
-    void depositHomePheromones(Environment& env);
-    void followFoodPheromones(Environment& env);
-    bool followHomePheromones(Environment& env);
-
-    // SFML Graphics Integration
-    void updateGraphics();
+    // Pheromones are read through the colony (last tick's levels) so its decay mode is applied consistently
+    void depositFoodPheromones(AntIntents& intents);
+    void depositHomePheromones(AntIntents& intents);
+    void followFoodPheromones(const Colony& colony, const Environment& env);
+    bool followHomePheromones(const Colony& colony, const Environment& env);
 
     // Lifespan & Combat future features
     bool isDead() const;
@@ -113,19 +96,13 @@ public:
     // isEnemy(const Ant& other)
     // getDistanceTo(const Ant& other)
 private:
-    float m_cellSize;
-    static int generateRand(int maxValue);
-	std::deque<std::pair<int, int>> recentPositions; // Ants shorterm memory of positions to avoid loops
-	int memoryLength; // Length of the ants short term memory for recent positions
+    unsigned int m_id;
+    CounterRng m_rng; // This tick's stream, re-keyed at the start of every updateSelf
+    int generateRand(int maxValue) { return m_rng.upTo(maxValue); } // 0..maxValue inclusive
+	AntStore::Memory recentPositions; // Ants shorterm memory of positions to avoid loops
 	int movesWhileReturningHome; // helper variable to track moves while returning home
 
     //future feature AntType m_antType;
-   
-    sf::Color m_colonyColor; // Colony Color
-    int m_colonyID;
-    // --- References to the colony's pheromone grids ---
-    std::vector<std::vector<float>>(&m_foodPheromones);
-    std::vector<std::vector<float>>(&m_returnHomePheromones);
 
 };
 
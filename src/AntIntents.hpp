@@ -0,0 +1,54 @@
+// AntSimulation - An SFML simulation of an ant colony.
+// Copyright (C) 2025 Logan Herrera <jherre36@live.nmhu.edu>
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#ifndef ANT_INTENTS_HPP
+#define ANT_INTENTS_HPP
+
+#include <cstddef>
+#include <vector>
+
+// Everything a block of ants wants to change during one tick.
+// Ants only read the colony and the environment while they decide, and write here instead, so blocks
+// can be updated on different threads. Colony merges the blocks in ant order afterwards.
+struct AntIntents {
+    struct Deposit {
+        int x, y;
+        float amount;
+    };
+    // A searching ant found food at (x, y). It has not moved or picked anything up yet; the colony calls
+    // Ant::takeFood only if the cell still has food when the claim comes up.
+    struct FoodClaim {
+        int x, y;
+        size_t antIndex; // Slot in Colony::ants
+    };
+
+    std::vector<Deposit> foodDeposits;
+    std::vector<Deposit> homeDeposits;
+    std::vector<FoodClaim> foodClaims;
+    std::vector<size_t> deaths;     // Slots of the ants whose lifespan ran out this tick
+    unsigned int foodDelivered = 0; // Food carried home this tick
+    size_t antIndex = 0;            // Slot (in Colony::ants) of the ant currently deciding
+
+    void clear() {
+        foodDeposits.clear();
+        homeDeposits.clear();
+        foodClaims.clear();
+        deaths.clear();
+        foodDelivered = 0;
+    }
+};
+
+#endif // ANT_INTENTS_HPP
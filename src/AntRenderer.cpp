@@ -0,0 +1,99 @@
+// AntSimulation - An SFML simulation of an ant colony.
+// Copyright (C) 2025 Logan Herrera <jherre36@live.nmhu.edu>
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#include "AntRenderer.hpp"
+#include <cmath>
+
+#ifndef M_PI
+#define M_PI 3.14159265358979323846
+#endif
+
+// Constructor
+AntRenderer::AntRenderer(const sf::Texture& antTexture, float cellSize)
+    : m_texture(antTexture),
+    m_cellSize(cellSize),
+    m_vertices(sf::Quads)
+{
+    const float textureWidth = static_cast<float>(antTexture.getSize().x);
+    const float textureHeight = static_cast<float>(antTexture.getSize().y);
+    m_texCoords[0] = sf::Vector2f(0.f, 0.f);
+    m_texCoords[1] = sf::Vector2f(textureWidth, 0.f);
+    m_texCoords[2] = sf::Vector2f(textureWidth, textureHeight);
+    m_texCoords[3] = sf::Vector2f(0.f, textureHeight);
+
+    // Rotate the corners of a cell-sized square once per direction, the same way sf::Transformable
+    // rotates a sprite about its centre (clockwise on screen, 45 degrees per direction)
+    const float half = cellSize / 2.f;
+    const sf::Vector2f corners[4] = {
+        sf::Vector2f(-half, -half), sf::Vector2f(half, -half), sf::Vector2f(half, half), sf::Vector2f(-half, half)
+    };
+    for (int direction = 0; direction < 8; ++direction) {
+        const float angle = static_cast<float>(direction) * 45.f * static_cast<float>(M_PI) / 180.f;
+        const float cosine = std::cos(angle);
+        const float sine = std::sin(angle);
+        for (int c = 0; c < 4; ++c) {
+            m_cornerOffsets[direction][c] = sf::Vector2f(corners[c].x * cosine - corners[c].y * sine,
+                corners[c].x * sine + corners[c].y * cosine);
+        }
+    }
+}
+
+void AntRenderer::draw(sf::RenderTarget& target, const WorldSnapshot& snapshot) {
+    if (prepare(snapshot) > 0) {
+        target.draw(m_vertices, sf::RenderStates(&m_texture));
+    }
+}
+
+size_t AntRenderer::prepare(const WorldSnapshot& snapshot) {
+    size_t antCount = 0;
+    for (const auto& colony : snapshot.colonies) {
+        antCount += colony.antX.size();
+    }
+    m_vertices.resize(antCount * 4);
+
+    size_t quad = 0;
+    for (const auto& colony : snapshot.colonies) {
+        for (size_t a = 0; a < colony.antX.size(); ++a) {
+            const int lifespan = colony.antLifespan[a];
+            if (lifespan <= 0) {
+                continue; // Dead ants are invisible
+            }
+
+            // Color logic
+            sf::Color antColor = colony.antHasFood[a] ? sf::Color::Green : colony.color;
+            // Lifespan fade effect: fade to a darker/greyer version of the original color
+            if (lifespan < FADE_LIFESPAN) {
+                const float fadeRatio = static_cast<float>(lifespan) / FADE_LIFESPAN;
+                antColor.r = static_cast<sf::Uint8>(antColor.r * fadeRatio);
+                antColor.g = static_cast<sf::Uint8>(antColor.g * fadeRatio);
+                antColor.b = static_cast<sf::Uint8>(antColor.b * fadeRatio);
+            }
+
+            const sf::Vector2f centre((static_cast<float>(colony.antX[a]) + 0.5f) * m_cellSize,
+                (static_cast<float>(colony.antY[a]) + 0.5f) * m_cellSize);
+            const sf::Vector2f* offsets = m_cornerOffsets[colony.antDirection[a] & 7];
+            sf::Vertex* vertex = &m_vertices[quad * 4];
+            for (int c = 0; c < 4; ++c) {
+                vertex[c].position = centre + offsets[c];
+                vertex[c].color = antColor;
+                vertex[c].texCoords = m_texCoords[c];
+            }
+            quad++;
+        }
+    }
+    m_vertices.resize(quad * 4); // Drop the slots of skipped ants
+    return quad;
+}
@@ -0,0 +1,140 @@
+// AntSimulation - An SFML simulation of an ant colony.
+// Copyright (C) 2025 Logan Herrera <jherre36@live.nmhu.edu>
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#include "AntStore.hpp"
+
+void AntStore::reserve(size_t count) {
+    x.reserve(count);
+    y.reserve(count);
+    prevX.reserve(count);
+    prevY.reserve(count);
+    direction.reserve(count);
+    hasFood.reserve(count);
+    lifespan.reserve(count);
+    pheromoneStrength.reserve(count);
+    movesWhileReturningHome.reserve(count);
+    id.reserve(count);
+    alive.reserve(count);
+    recentPositions.reserve(count);
+}
+
+void AntStore::clear() {
+    x.clear();
+    y.clear();
+    prevX.clear();
+    prevY.clear();
+    direction.clear();
+    hasFood.clear();
+    lifespan.clear();
+    pheromoneStrength.clear();
+    movesWhileReturningHome.clear();
+    id.clear();
+    alive.clear();
+    recentPositions.clear();
+    m_freeSlots.clear();
+    m_liveCount = 0;
+}
+
+size_t AntStore::insert(int startX, int startY, int startDirection, unsigned int antID, int startLifespan, float startPheromoneStrength) {
+    size_t slot;
+    if (!m_freeSlots.empty()) {
+        slot = m_freeSlots.back();
+        m_freeSlots.pop_back();
+    }
+    else {
+        slot = x.size();
+        x.emplace_back();
+        y.emplace_back();
+        prevX.emplace_back();
+        prevY.emplace_back();
+        direction.emplace_back();
+        hasFood.emplace_back();
+        lifespan.emplace_back();
+        pheromoneStrength.emplace_back();
+        movesWhileReturningHome.emplace_back();
+        id.emplace_back();
+        alive.emplace_back();
+        recentPositions.emplace_back();
+    }
+
+    x[slot] = startX;
+    y[slot] = startY;
+    prevX[slot] = startX;
+    prevY[slot] = startY;
+    direction[slot] = startDirection;
+    hasFood[slot] = 0;
+    lifespan[slot] = startLifespan;
+    pheromoneStrength[slot] = startPheromoneStrength;
+    movesWhileReturningHome[slot] = 0;
+    id[slot] = antID;
+    alive[slot] = 1;
+    recentPositions[slot] = Memory();
+    recentPositions[slot].push(startX, startY);
+    m_liveCount++;
+    return slot;
+}
+
+void AntStore::release(size_t slot) {
+    alive[slot] = 0;
+    hasFood[slot] = 0;
+    m_freeSlots.push_back(slot);
+    m_liveCount--;
+}
+
+bool AntStore::needsCompaction() const {
+    return m_freeSlots.size() >= COMPACT_MIN_FREE_SLOTS
+        && m_freeSlots.size() * COMPACT_FREE_FRACTION > slotCount();
+}
+
+// Single pass over every array (the SoA equivalent of erase(remove_if(...)))
+void AntStore::compact() {
+    const size_t count = slotCount();
+    size_t kept = 0;
+    for (size_t i = 0; i < count; ++i) {
+        if (!alive[i]) {
+            continue;
+        }
+        if (kept != i) {
+            x[kept] = x[i];
+            y[kept] = y[i];
+            prevX[kept] = prevX[i];
+            prevY[kept] = prevY[i];
+            direction[kept] = direction[i];
+            hasFood[kept] = hasFood[i];
+            lifespan[kept] = lifespan[i];
+            pheromoneStrength[kept] = pheromoneStrength[i];
+            movesWhileReturningHome[kept] = movesWhileReturningHome[i];
+            id[kept] = id[i];
+            alive[kept] = 1;
+            recentPositions[kept] = recentPositions[i];
+        }
+        kept++;
+    }
+
+    x.resize(kept);
+    y.resize(kept);
+    prevX.resize(kept);
+    prevY.resize(kept);
+    direction.resize(kept);
+    hasFood.resize(kept);
+    lifespan.resize(kept);
+    pheromoneStrength.resize(kept);
+    movesWhileReturningHome.resize(kept);
+    id.resize(kept);
+    alive.resize(kept);
+    recentPositions.resize(kept);
+    m_freeSlots.clear();
+}
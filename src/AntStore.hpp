@@ -0,0 +1,89 @@
+// AntSimulation - An SFML simulation of an ant colony.
+// Copyright (C) 2025 Logan Herrera <jherre36@live.nmhu.edu>
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#ifndef ANT_STORE_HPP
+#define ANT_STORE_HPP
+
+#include <cstddef>
+#include "PositionMemory.hpp"
+#include <cstdint>
+#include <type_traits>
+#include <vector>
+
+// Structure-of-arrays storage for a colony's ants.
+// The fields every ant touches every tick live in their own contiguous arrays, so the tick loop streams
+// through a few bytes per ant instead of whole objects.
+// Anything needed only to draw an ant (position, color, rotation) is rebuilt from these arrays per frame.
+// Ant is the working copy the behaviour code runs on: loaded from slot i, updated, then written back.
+//
+// Each ant occupies a slot. A dying ant just frees its slot (O(1)); the next spawn reuses the most
+// recently freed slot, so the arrays only grow past the peak population and nothing moves when ants die.
+// Loops run over every slot and skip the free ones. When more than a quarter of the slots are free the
+// living ants are compacted down in order, which is the only time an ant changes slot. An ant's id never
+// changes, so it is the handle to keep across ticks; a slot index is only good until the next compaction.
+class AntStore {
+public:
+    static constexpr size_t MEMORY_LENGTH = 10; // Length of the ants short term memory for recent positions
+    using Memory = PositionMemory<MEMORY_LENGTH>;
+
+    // --- Hot: read and written by every ant every tick ---
+    std::vector<int> x, y;
+    std::vector<int> prevX, prevY;
+    std::vector<int> direction;                // 0-7, clockwise from North
+    std::vector<std::uint8_t> hasFood;         // 0 or 1 (not vector<bool>, which packs bits)
+    std::vector<int> lifespan;
+    std::vector<float> pheromoneStrength;
+    std::vector<int> movesWhileReturningHome;
+    std::vector<unsigned int> id;              // Stable within the colony; keys the ant's random stream
+    std::vector<std::uint8_t> alive;           // 0 for a free slot, which every loop skips
+
+    // --- Cold: only consulted while choosing a direction ---
+    std::vector<Memory> recentPositions; // Short term memory of visited cells
+
+    // Compact once at least this many slots, and more than 1/COMPACT_FREE_FRACTION of them, are free
+    static constexpr size_t COMPACT_MIN_FREE_SLOTS = 256;
+    static constexpr size_t COMPACT_FREE_FRACTION = 4;
+
+    size_t size() const { return m_liveCount; }      // Living ants
+    bool empty() const { return m_liveCount == 0; }
+    size_t slotCount() const { return x.size(); }    // Living ants plus free slots; loops run up to this
+    size_t freeSlotCount() const { return m_freeSlots.size(); }
+
+    void reserve(size_t count);
+    void clear();
+
+    // Places a freshly spawned ant standing at (startX, startY) in a free slot, or a new one at the end.
+    // Returns the slot.
+    size_t insert(int startX, int startY, int startDirection, unsigned int antID, int startLifespan, float startPheromoneStrength);
+
+    // Frees the slot of an ant that died. Nothing else moves.
+    void release(size_t slot);
+
+    // True once enough slots are free that loops spend a noticeable share of their time skipping them
+    bool needsCompaction() const;
+
+    // Moves the living ants down over the free slots, keeping them in order, and drops the free list.
+    // Every slot index held outside the store is stale afterwards.
+    void compact();
+
+private:
+    std::vector<size_t> m_freeSlots; // Most recently freed last
+    size_t m_liveCount = 0;
+};
+
+static_assert(std::is_trivially_copyable<AntStore::Memory>::value, "ant memory must be movable with memcpy");
+
+#endif // ANT_STORE_HPP
@@ -17,6 +17,8 @@
 #include "Colony.hpp"
 #include "Ant.hpp"
 #include "Environment.hpp"
+#include "Profiler.hpp"
+#include "RandomUtils.hpp"
 #include <algorithm>
 #include <iostream>
 #include <vector>
@@ -26,19 +28,23 @@
 int Colony::nextColonyID = 0;
 
 // Constructor
-Colony::Colony(int colonyX, int colonyY, int initialNumAnts, float antsCellSize, const sf::Color& color, int id, const sf::Texture& antTexture)
+Colony::Colony(int colonyX, int colonyY, int initialNumAnts, const sf::Color& color, int id,
+    int gridWidth, int gridHeight, PheromoneDecayMode decayMode, std::uint64_t randomSeed,
+    WorldStorage storage, InterleavedPheromones* sharedPheromones)
     : homeX(colonyX),
     homeY(colonyY),
     peakPopulation(initialNumAnts),
-    m_antsCellSize(antsCellSize),
     m_antsToSpawnThisTurn(0),
     colonyColor(color),
     id(id),
     foodStored(0),
     totalAntsDied(0),
-    foodPheromones(Environment::GRID_SIZE, std::vector<float>(Environment::GRID_SIZE, 0.0f)),
-    returnHomePheromones(Environment::GRID_SIZE, std::vector<float>(Environment::GRID_SIZE, 0.0f)),
-    m_antTexture(antTexture) // <<< INITIALIZE the texture reference
+    pheromones(gridWidth, gridHeight, decayMode, storage, sharedPheromones, id),
+    homeField(colonyX, colonyY, gridWidth, gridHeight),
+    m_seed(randomSeed),
+    m_tick(0),
+    m_nextAntID(0),
+    m_activeBlocks(0)
 {
     ants.reserve(initialNumAnts + 100);
     spawnAnts(initialNumAnts);
@@ -61,101 +67,127 @@ void Colony::addFood(unsigned int amount) {
 // Used for deferred spawning
 void Colony::spawnAnts(int numAntsToSpawn) {
     for (int i = 0; i < numAntsToSpawn; i++) {
-        // Pass the colony's color, its pheromone grids, ID, AND the ant texture
-        ants.emplace_back(homeX, homeY, homeX, homeY, m_antsCellSize, this->colonyColor,
-            foodPheromones, returnHomePheromones, this->id, m_antTexture); // <<< PASS texture
+        // The starting direction comes from the ant's own spawn stream, so it does not depend on spawn order
+        const unsigned int antID = m_nextAntID++;
+        CounterRng spawnRng(m_seed, m_tick, static_cast<std::uint32_t>(id), antID, CounterRng::AntSpawn);
+        ants.insert(homeX, homeY, spawnRng.upTo(7), antID, Ant::MAX_LIFESPAN, Ant::INITIAL_PHEROMONE_STRENGTH);
     }
 }
 
 void Colony::update(Environment& env, const std::vector<Colony>& allColonies) {
-   // m_antsToSpawnThisTurn = 0;
-
-    for (size_t i = 0; i < ants.size(); ++i) {
-        ants[i].updateSelf(env, *this);
+    ANTSIM_PROFILE_SCOPE("colony.update");
+    const size_t blockCount = beginTick();
+    for (size_t block = 0; block < blockCount; ++block) {
+        updateAntBlock(block, env);
     }
+    applyIntents();
+    resolveFoodClaims(env);
+    finishTick();
+}
 
-    size_t antsBeforeErase = ants.size(); // Get count before erase
-    //lambda to rearrange elements so that all ants that satisfy the condition (ant.isDead() == true) are moved to the end of the vector.
-	//std::remove_if - removes those elements from the vector, effectively erasing them with ants.erase.
-    ants.erase(std::remove_if(ants.begin(), ants.end(),
-        [](const Ant& ant) { return ant.isDead(); }),
-        ants.end());
-    size_t antsAfterErase = ants.size(); // Get count after erase
-
-    totalAntsDied += (antsBeforeErase - antsAfterErase); // Increment totalAntsDied
-
-
-    // Check if enough food is stored to spawn new ants
-    while (foodStored >= FOOD_REQUIRED_PER_ANT_SPAWN) { // While loop to spawn multiple if enough food
-        spawnAnts(1); // Spawn one ant
-        foodStored -= FOOD_REQUIRED_PER_ANT_SPAWN; // Consume the food
+size_t Colony::beginTick() {
+   // m_antsToSpawnThisTurn = 0;
+    m_activeBlocks = (ants.slotCount() + ANT_BLOCK_SIZE - 1) / ANT_BLOCK_SIZE;
+    if (m_blocks.size() < m_activeBlocks) {
+        m_blocks.resize(m_activeBlocks);
     }
 
-	// Update peak population if the current number of ants exceeds it
-    if (ants.size() > peakPopulation) {
-        peakPopulation = ants.size();
+    for (size_t block = 0; block < m_activeBlocks; ++block) {
+        m_blocks[block].clear();
     }
-	// Update pheromones after all ants have been updated
-    updatePheromones();
+    return m_activeBlocks;
 }
 
-// Colony Pheromone management methods
-void Colony::addFoodPheromone(int gridX, int gridY, float amount) {
-    if (gridX >= 0 && gridX < Environment::GRID_SIZE && gridY >= 0 && gridY < Environment::GRID_SIZE) {
-        foodPheromones[gridX][gridY] += amount; // Access using std::vector syntax
-        if (foodPheromones[gridX][gridY] > MAX_PHEROMONE_LEVEL) {
-            foodPheromones[gridX][gridY] = MAX_PHEROMONE_LEVEL;
+void Colony::updateAntBlock(size_t block, const Environment& env) {
+    AntIntents& intents = m_blocks[block];
+    const size_t end = std::min(ants.slotCount(), (block + 1) * ANT_BLOCK_SIZE);
+    for (size_t i = block * ANT_BLOCK_SIZE; i < end; ++i) {
+        if (!ants.alive[i]) {
+            continue; // Free slot
         }
-        if (foodPheromones[gridX][gridY] < 0) {
-            foodPheromones[gridX][gridY] = 0.0f;
+        intents.antIndex = i;
+        Ant ant(ants, i, homeX, homeY);
+        ant.updateSelf(env, *this, intents);
+        ant.writeBack(ants, i);
+        if (ants.lifespan[i] <= 0) {
+            intents.deaths.push_back(i); // Slot is freed in finishTick, after the food claims
         }
     }
 }
 
-float Colony::getFoodPheromoneLevel(int gridX, int gridY) const {
-    if (gridX >= 0 && gridX < Environment::GRID_SIZE && gridY >= 0 && gridY < Environment::GRID_SIZE) {
-        return foodPheromones[gridX][gridY];
-    }
-    return 0.0f;
-}
-
-void Colony::addReturnHomePheromone(int gridX, int gridY, float amount) {
-    if (gridX >= 0 && gridX < Environment::GRID_SIZE && gridY >= 0 && gridY < Environment::GRID_SIZE) {
-        returnHomePheromones[gridX][gridY] += amount;
-        if (returnHomePheromones[gridX][gridY] > MAX_PHEROMONE_LEVEL) {
-            returnHomePheromones[gridX][gridY] = MAX_PHEROMONE_LEVEL;
+// Blocks are merged in order, so deposits are summed in ant order whatever thread produced them
+void Colony::applyIntents() {
+    for (size_t block = 0; block < m_activeBlocks; ++block) {
+        const AntIntents& intents = m_blocks[block];
+        for (const AntIntents::Deposit& deposit : intents.foodDeposits) {
+            pheromones.addFood(deposit.x, deposit.y, deposit.amount);
         }
-        if (returnHomePheromones[gridX][gridY] < 0.0f) {
-            returnHomePheromones[gridX][gridY] = 0.0f;
+        for (const AntIntents::Deposit& deposit : intents.homeDeposits) {
+            pheromones.addHome(deposit.x, deposit.y, deposit.amount);
         }
+        addFood(intents.foodDelivered);
     }
 }
 
-float Colony::getReturnHomePheromoneLevel(int gridX, int gridY) const {
-    if (gridX >= 0 && gridX < Environment::GRID_SIZE && gridY >= 0 && gridY < Environment::GRID_SIZE) {
-        return returnHomePheromones[gridX][gridY];
+// Claims are granted in slot order; ants are still in the same slots because dead ants are only
+// released in finishTick. An ant that lost the race for the last unit was never changed, so there is
+// nothing to undo.
+void Colony::resolveFoodClaims(Environment& env) {
+    m_pickupIntents.clear();
+    for (size_t block = 0; block < m_activeBlocks; ++block) {
+        for (const AntIntents::FoodClaim& claim : m_blocks[block].foodClaims) {
+            if (!env.checkForFood(claim.x, claim.y)) {
+                continue;
+            }
+            env.removeFood(claim.x, claim.y);
+            Ant ant(ants, claim.antIndex, homeX, homeY);
+            ant.takeFood(claim.x, claim.y, m_pickupIntents);
+            ant.writeBack(ants, claim.antIndex);
+        }
+    }
+    for (const AntIntents::Deposit& deposit : m_pickupIntents.foodDeposits) {
+        pheromones.addFood(deposit.x, deposit.y, deposit.amount);
     }
-    return 0.0f;
 }
 
-void Colony::updatePheromones() {
-    for (int i = 0; i < Environment::GRID_SIZE; ++i) {
-        for (int j = 0; j < Environment::GRID_SIZE; ++j) {
-            if (foodPheromones[i][j] > 0.001f) {
-                foodPheromones[i][j] *= PHEROMONE_DECAY_RATE;
-                if (foodPheromones[i][j] < 0.001f) foodPheromones[i][j] = 0.0f;
-            }
-            else {
-                foodPheromones[i][j] = 0.0f;
+void Colony::finishTick() {
+    // Free the slots of the ants that died; survivors stay where they are
+    {
+        ANTSIM_PROFILE_SCOPE("colony.release_dead");
+        for (size_t block = 0; block < m_activeBlocks; ++block) {
+            for (size_t slot : m_blocks[block].deaths) {
+                ants.release(slot);
             }
+            totalAntsDied += m_blocks[block].deaths.size(); // Increment totalAntsDied
+        }
+    }
 
-            if (returnHomePheromones[i][j] > 0.001f) {
-                returnHomePheromones[i][j] *= PHEROMONE_DECAY_RATE;
-                if (returnHomePheromones[i][j] < 0.001f) returnHomePheromones[i][j] = 0.0f;
-            }
-            else {
-                returnHomePheromones[i][j] = 0.0f;
-            }
+    // Check if enough food is stored to spawn new ants (they take over the freed slots first)
+    {
+        ANTSIM_PROFILE_SCOPE("colony.spawn");
+        while (foodStored >= FOOD_REQUIRED_PER_ANT_SPAWN) { // While loop to spawn multiple if enough food
+            spawnAnts(1); // Spawn one ant
+            foodStored -= FOOD_REQUIRED_PER_ANT_SPAWN; // Consume the food
         }
     }
-}
\ No newline at end of file
+
+    // Only when a die-off has left many slots empty: close the gaps, keeping survivors in order
+    if (ants.needsCompaction()) {
+        ANTSIM_PROFILE_SCOPE("colony.compact");
+        ants.compact();
+    }
+
+	// Update peak population if the current number of ants exceeds it
+    if (ants.size() > peakPopulation) {
+        peakPopulation = ants.size();
+    }
+	// Update pheromones after all ants have been updated
+    updatePheromones();
+    m_tick++;
+}
+
+// Decay is handled by the pheromone field, which only visits cells that currently hold pheromone
+void Colony::updatePheromones() {
+    ANTSIM_PROFILE_SCOPE("colony.pheromone_decay");
+    pheromones.decay();
+}
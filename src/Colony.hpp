@@ -17,7 +17,13 @@
 #ifndef COLONY_HPP
 #define COLONY_HPP
 
+#include "AntIntents.hpp"
+#include "AntStore.hpp"
 #include "Environment.hpp"
+#include "HomeField.hpp"
+#include "PheromoneField.hpp"
+#include "RandomUtils.hpp"
+#include <cstdint>
 #include <vector>
 #include <SFML/Graphics.hpp>
 
@@ -27,7 +33,7 @@ class Colony {
 public:
     int homeX, homeY;
     unsigned long long peakPopulation;
-    std::vector<Ant> ants;
+    AntStore ants; // Structure-of-arrays; see Ant for the per-ant working copy
     sf::Color colonyColor;
 
     // Unique identifier for each colony
@@ -41,16 +47,21 @@ public:
     // --- Counter for total ants that have died from this colony ---
     unsigned long long totalAntsDied; // Using unsigned long long for large numbers
 
-    // --- Pheromone grids owned by the colony ---
-    std::vector<std::vector<float>> foodPheromones; // "Food Trail" pheromones
-    std::vector<std::vector<float>> returnHomePheromones; // "Home trail" pheromones
+    // --- Pheromone grids owned by the colony ("Food Trail" and "Home trail"), sized to the world, or the
+    //     colony's channels of the shared interleaved grid when one is passed to the constructor ---
+    PheromoneField pheromones;
+
+    // --- Distance and direction to home around the nest, built once because home never moves ---
+    HomeField homeField;
 
     // --- Pheromone constants for this colony ---
-	static constexpr float PHEROMONE_DECAY_RATE = 0.98f; // How quickly pheromones fade over time
-    static constexpr float MAX_PHEROMONE_LEVEL = 500.0f; // A cap for pheromone levels
+	static constexpr float PHEROMONE_DECAY_RATE = PheromoneField::DECAY_RATE; // How quickly pheromones fade over time
+    static constexpr float MAX_PHEROMONE_LEVEL = PheromoneField::MAX_LEVEL; // A cap for pheromone levels
 
     // Constructor
-    Colony(int colonyX, int colonyY, int initialNumAnts, float antsCellSize, const sf::Color& color, int id, const sf::Texture& antTexture);
+    Colony(int colonyX, int colonyY, int initialNumAnts, const sf::Color& color, int id,
+        int gridWidth, int gridHeight, PheromoneDecayMode decayMode = PheromoneDecayMode::Eager, std::uint64_t randomSeed = 0,
+        WorldStorage storage = WorldStorage::Dense, InterleavedPheromones* sharedPheromones = nullptr);
 
 
     Colony(const Colony&) = delete;
@@ -61,25 +72,63 @@ public:
     // Destructor
     ~Colony();
 
-    // Main update method for the colony
+    // Ants are updated in fixed-size blocks, each with its own intent buffer, so blocks can be
+    // shared out between threads
+    static constexpr size_t ANT_BLOCK_SIZE = 512;
+
+    // Main update method for the colony (runs every phase below on the calling thread)
     void update(Environment& env, const std::vector<Colony>& allColonies);
 
+    // --- Phases of a tick (Simulation::step runs them across all colonies, in parallel where allowed) ---
+    // 1. beginTick: splits the ants into blocks. Returns the block count.
+    // 2. updateAntBlock: every ant in the block senses last tick's pheromones and food and records its
+    //    intents. Only reads shared state, so any blocks of any colonies can run concurrently.
+    // 3. applyIntents: adds the pheromone deposits and delivered food, in ant order. Touches only this colony.
+    // 4. resolveFoodClaims: grants food claims in ant order (serially, in colony order). The winner removes
+    //    the food, picks it up and lays its first food trail; an ant whose cell already ran dry is untouched.
+    // 5. finishTick: frees dead ants' slots, spawns new ones into them, compacts the ant arrays if they
+    //    have become too sparse and decays pheromones. Touches only this colony, except that with a shared
+    //    interleaved grid the first colony to decay sweeps every colony's channels (nothing else writes
+    //    the grid during this phase).
+    size_t beginTick();
+    void updateAntBlock(size_t block, const Environment& env);
+    void applyIntents();
+    void resolveFoodClaims(Environment& env);
+    void finishTick();
+
     
     // Adds a unit of food to the colony's stored supply
     void addFood(unsigned int amount = 1);
 
     // --- Pheromone management methods for this colony ---
-    void addFoodPheromone(int gridX, int gridY, float amount);
-    float getFoodPheromoneLevel(int gridX, int gridY) const;
-    void addReturnHomePheromone(int gridX, int gridY, float amount);
-    float getReturnHomePheromoneLevel(int gridX, int gridY) const;
+    // Levels are returned in real (decayed) units regardless of decay mode; out of bounds reads return 0
+    void addFoodPheromone(int gridX, int gridY, float amount) { pheromones.addFood(gridX, gridY, amount); }
+    float getFoodPheromoneLevel(int gridX, int gridY) const { return pheromones.foodLevel(gridX, gridY); }
+    void addReturnHomePheromone(int gridX, int gridY, float amount) { pheromones.addHome(gridX, gridY, amount); }
+    float getReturnHomePheromoneLevel(int gridX, int gridY) const { return pheromones.homeLevel(gridX, gridY); }
+    // Levels of all 8 neighbours of an in-bounds cell in one gather (direction order, 0 outside the world)
+    void getFoodPheromoneNeighbors(int gridX, int gridY, float levels[Directions::COUNT]) const { pheromones.gatherFood(gridX, gridY, levels); }
+    void getReturnHomePheromoneNeighbors(int gridX, int gridY, float levels[Directions::COUNT]) const { pheromones.gatherHome(gridX, gridY, levels); }
     void updatePheromones(); // Method to handle decay for this colony's pheromones
 
+    // The random stream for one of this colony's ants during the current tick
+    CounterRng antRandom(unsigned int antID) const {
+        return CounterRng(m_seed, m_tick, static_cast<std::uint32_t>(id), antID, CounterRng::AntUpdate);
+    }
+
 private:
-    float m_antsCellSize;
     int m_antsToSpawnThisTurn;
     void spawnAnts(int numAntsToSpawn);
-	const sf::Texture& m_antTexture; // Texture for the ants
+
+    // Random streams are keyed by (seed, tick, colony, ant), so results do not depend on which thread
+    // updates an ant or in what order
+    std::uint64_t m_seed;
+    unsigned long long m_tick; // Ticks this colony has completed
+    unsigned int m_nextAntID;
+
+    std::vector<AntIntents> m_blocks; // One per block of ants; reused between ticks so the buffers keep their capacity
+    size_t m_activeBlocks;
+    AntIntents m_pickupIntents; // Trail deposits of the ants whose food claims were granted this tick
 };
 
 #endif // COLONY_HPP
\ No newline at end of file
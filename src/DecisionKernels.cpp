@@ -0,0 +1,214 @@
+// AntSimulation - An SFML simulation of an ant colony.
+// Copyright (C) 2025 Logan Herrera <jherre36@live.nmhu.edu>
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+
+#include "DecisionKernels.hpp"
+#include "PheromoneKernels.hpp"
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+#define ANTSIM_X86 1
+#include <immintrin.h>
+#endif
+
+// Same per-function targeting as the decay kernels, so the binary still runs on CPUs without AVX2
+#if defined(ANTSIM_X86) && (defined(__GNUC__) || defined(__clang__))
+#define ANTSIM_TARGET_AVX2 __attribute__((target("avx2")))
+#define ANTSIM_TARGET_SSE2 __attribute__((target("sse2")))
+#else
+#define ANTSIM_TARGET_AVX2
+#define ANTSIM_TARGET_SSE2
+#endif
+
+// Directions 1, 3, 5 and 7 are diagonal
+static constexpr unsigned DIAGONAL_LANES = 0xAAu;
+
+// Reference implementation, one lane at a time in the order the ants used to apply the factors
+static unsigned weighScalar(const DecisionKernels::Lanes& lanes, const DecisionKernels::Rule& rule, float weights[Directions::COUNT]) {
+    unsigned result = 0;
+    for (int d = 0; d < Directions::COUNT; ++d) {
+        const float level = lanes.levels[d];
+        float weight = level;
+        if ((lanes.recent >> d) & 1u) weight *= rule.recentFactor;
+        if (lanes.distances[d] < lanes.currentDistance) weight *= rule.towardFactor;
+        else if (lanes.distances[d] > lanes.currentDistance) weight *= rule.awayFactor;
+        if ((DIAGONAL_LANES >> d) & 1u) weight *= rule.diagonalFactor;
+
+        const bool candidate = ((lanes.candidates >> d) & 1u) && level > rule.minLevel && weight > rule.minWeight;
+        weights[d] = candidate ? weight : 0.0f;
+        result |= static_cast<unsigned>(candidate) << d;
+    }
+    return result;
+}
+
+#ifdef ANTSIM_X86
+// Lane mask (all ones where bit d of bits is set) for lanes [first, first + 4)
+ANTSIM_TARGET_SSE2
+static inline __m128 bitLanesSSE(unsigned bits, int first) {
+    const __m128i laneBits = _mm_setr_epi32(1 << first, 1 << (first + 1), 1 << (first + 2), 1 << (first + 3));
+    const __m128i selected = _mm_and_si128(_mm_set1_epi32(static_cast<int>(bits)), laneBits);
+    return _mm_castsi128_ps(_mm_cmpeq_epi32(selected, laneBits));
+}
+
+// factor where mask is set, exactly 1 elsewhere (SSE2 has no blend: (mask & factor) | (~mask & 1))
+ANTSIM_TARGET_SSE2
+static inline __m128 factorSSE(__m128 mask, __m128 factor, __m128 one) {
+    return _mm_or_ps(_mm_and_ps(mask, factor), _mm_andnot_ps(mask, one));
+}
+
+ANTSIM_TARGET_SSE2
+static unsigned weighSSE(const DecisionKernels::Lanes& lanes, const DecisionKernels::Rule& rule, float weights[Directions::COUNT]) {
+    const __m128 one = _mm_set1_ps(1.0f);
+    const __m128 current = _mm_set1_ps(lanes.currentDistance);
+    unsigned result = 0;
+    for (int first = 0; first < Directions::COUNT; first += 4) {
+        const __m128 level = _mm_loadu_ps(lanes.levels + first);
+        const __m128 distance = _mm_loadu_ps(lanes.distances + first);
+        const __m128 toward = _mm_cmplt_ps(distance, current);
+        const __m128 away = _mm_cmpgt_ps(distance, current);
+
+        __m128 weight = _mm_mul_ps(level, factorSSE(bitLanesSSE(lanes.recent, first), _mm_set1_ps(rule.recentFactor), one));
+        weight = _mm_mul_ps(weight, factorSSE(toward, _mm_set1_ps(rule.towardFactor), factorSSE(away, _mm_set1_ps(rule.awayFactor), one)));
+        weight = _mm_mul_ps(weight, factorSSE(bitLanesSSE(DIAGONAL_LANES, first), _mm_set1_ps(rule.diagonalFactor), one));
+
+        const __m128 candidate = _mm_and_ps(bitLanesSSE(lanes.candidates, first),
+            _mm_and_ps(_mm_cmpgt_ps(level, _mm_set1_ps(rule.minLevel)), _mm_cmpgt_ps(weight, _mm_set1_ps(rule.minWeight))));
+        _mm_storeu_ps(weights + first, _mm_and_ps(weight, candidate));
+        result |= static_cast<unsigned>(_mm_movemask_ps(candidate)) << first;
+    }
+    return result;
+}
+
+ANTSIM_TARGET_AVX2
+static inline __m256 bitLanesAVX2(unsigned bits) {
+    const __m256i laneBits = _mm256_setr_epi32(1, 2, 4, 8, 16, 32, 64, 128);
+    const __m256i selected = _mm256_and_si256(_mm256_set1_epi32(static_cast<int>(bits)), laneBits);
+    return _mm256_castsi256_ps(_mm256_cmpeq_epi32(selected, laneBits));
+}
+
+ANTSIM_TARGET_AVX2
+static unsigned weighAVX2(const DecisionKernels::Lanes& lanes, const DecisionKernels::Rule& rule, float weights[Directions::COUNT]) {
+    const __m256 one = _mm256_set1_ps(1.0f);
+    const __m256 level = _mm256_loadu_ps(lanes.levels);
+    const __m256 distance = _mm256_loadu_ps(lanes.distances);
+    const __m256 current = _mm256_set1_ps(lanes.currentDistance);
+
+    const __m256 recentFactor = _mm256_blendv_ps(one, _mm256_set1_ps(rule.recentFactor), bitLanesAVX2(lanes.recent));
+    const __m256 homeFactor = _mm256_blendv_ps(
+        _mm256_blendv_ps(one, _mm256_set1_ps(rule.awayFactor), _mm256_cmp_ps(distance, current, _CMP_GT_OQ)),
+        _mm256_set1_ps(rule.towardFactor), _mm256_cmp_ps(distance, current, _CMP_LT_OQ));
+    const __m256 diagonalFactor = _mm256_blendv_ps(one, _mm256_set1_ps(rule.diagonalFactor), bitLanesAVX2(DIAGONAL_LANES));
+    const __m256 weight = _mm256_mul_ps(_mm256_mul_ps(_mm256_mul_ps(level, recentFactor), homeFactor), diagonalFactor);
+
+    const __m256 candidate = _mm256_and_ps(bitLanesAVX2(lanes.candidates),
+        _mm256_and_ps(_mm256_cmp_ps(level, _mm256_set1_ps(rule.minLevel), _CMP_GT_OQ),
+            _mm256_cmp_ps(weight, _mm256_set1_ps(rule.minWeight), _CMP_GT_OQ)));
+    _mm256_storeu_ps(weights, _mm256_and_ps(weight, candidate));
+    return static_cast<unsigned>(_mm256_movemask_ps(candidate));
+}
+#endif // ANTSIM_X86
+
+unsigned DecisionKernels::weigh(const Lanes& lanes, const Rule& rule, float weights[Directions::COUNT]) {
+    static const Kernel best = bestAvailableKernel();
+    return weigh(best, lanes, rule, weights);
+}
+
+unsigned DecisionKernels::weigh(Kernel kernel, const Lanes& lanes, const Rule& rule, float weights[Directions::COUNT]) {
+    if (kernel != Kernel::Scalar && !isSupported(kernel)) {
+        kernel = bestAvailableKernel();
+    }
+    switch (kernel) {
+#ifdef ANTSIM_X86
+    case Kernel::AVX2:
+        return weighAVX2(lanes, rule, weights);
+    case Kernel::SSE:
+        return weighSSE(lanes, rule, weights);
+#endif
+    default:
+        return weighScalar(lanes, rule, weights);
+    }
+}
+
+// Rejected lanes hold 0, and adding 0 changes no sum, so this equals the old sum over candidates only
+float DecisionKernels::total(const float weights[Directions::COUNT]) {
+    float sum = 0.0f;
+    for (int d = 0; d < Directions::COUNT; ++d) {
+        sum += weights[d];
+    }
+    return sum;
+}
+
+int DecisionKernels::pick(const float weights[Directions::COUNT], unsigned candidates, float randomPick) {
+    float runningSum = 0.0f;
+    unsigned reached = 0;
+    for (int d = 0; d < Directions::COUNT; ++d) {
+        runningSum += weights[d];
+        reached |= static_cast<unsigned>(randomPick <= runningSum) << d;
+    }
+    reached &= candidates;
+    return reached != 0 ? nth(reached, 0) : -1;
+}
+
+int DecisionKernels::heaviest(const float weights[Directions::COUNT], unsigned candidates) {
+    int best = -1;
+    float bestWeight = 0.0f;
+    for (int d = 0; d < Directions::COUNT; ++d) {
+        if (((candidates >> d) & 1u) && (best == -1 || weights[d] > bestWeight)) {
+            best = d;
+            bestWeight = weights[d];
+        }
+    }
+    return best;
+}
+
+int DecisionKernels::count(unsigned lanes) {
+    int n = 0;
+    for (lanes &= 0xFFu; lanes != 0; lanes &= lanes - 1) {
+        n++;
+    }
+    return n;
+}
+
+int DecisionKernels::nth(unsigned lanes, int n) {
+    for (int d = 0; d < Directions::COUNT; ++d) {
+        if ((lanes >> d) & 1u) {
+            if (n == 0) return d;
+            n--;
+        }
+    }
+    return -1;
+}
+
+// The CPU checks are the ones the decay kernels already cache
+bool DecisionKernels::isSupported(Kernel kernel) {
+    switch (kernel) {
+    case Kernel::Scalar: return true;
+    case Kernel::SSE: return PheromoneKernels::isSupported(PheromoneKernels::DecayKernel::SSE);
+    case Kernel::AVX2: return PheromoneKernels::isSupported(PheromoneKernels::DecayKernel::AVX2);
+    default: return false;
+    }
+}
+
+DecisionKernels::Kernel DecisionKernels::bestAvailableKernel() {
+    return isSupported(Kernel::AVX2) ? Kernel::AVX2 : isSupported(Kernel::SSE) ? Kernel::SSE : Kernel::Scalar;
+}
+
+const char* DecisionKernels::kernelName(Kernel kernel) {
+    switch (kernel) {
+    case Kernel::SSE: return "sse";
+    case Kernel::AVX2: return "avx2";
+    default: return "scalar";
+    }
+}
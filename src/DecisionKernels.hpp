@@ -0,0 +1,77 @@
+// AntSimulation - An SFML simulation of an ant colony.
+// Copyright (C) 2025 Logan Herrera <jherre36@live.nmhu.edu>
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+
+#ifndef DECISION_KERNELS_HPP
+#define DECISION_KERNELS_HPP
+
+#include "Directions.hpp"
+
+// The weighted 8-way direction choice shared by the pheromone-following ants, as fixed-size lane kernels.
+// Lane d is direction d (Directions::DX/DY). Weighing a neighbour multiplies its pheromone level by each factor
+// that applies, and an unused factor is exactly 1, so the SIMD versions produce bit-identical weights to the
+// old per-candidate loop. Sums and the pick run in direction order like before; nothing touches the heap.
+class DecisionKernels {
+public:
+    enum class Kernel {
+        Scalar, // Portable fallback, used on non-x86 targets
+        SSE,    // Two 4-lane halves
+        AVX2    // All 8 lanes at once
+    };
+
+    // Per-direction inputs of one choice
+    struct Lanes {
+        float levels[Directions::COUNT];    // Pheromone level of each neighbour
+        float distances[Directions::COUNT]; // Each neighbour's distance to home
+        float currentDistance;              // The ant's own distance to home
+        unsigned candidates;                // Lanes that may be chosen at all (inside the world, not the cell just left)
+        unsigned recent;                    // Lanes in the ant's short term memory
+    };
+
+    // How levels become weights: level * recentFactor (if remembered) * towardFactor or awayFactor (if the
+    // neighbour is closer to / farther from home) * diagonalFactor (odd directions)
+    struct Rule {
+        float minLevel;       // Lanes need a level above this...
+        float minWeight;      // ...and a weight above this to stay candidates
+        float recentFactor;
+        float towardFactor;
+        float awayFactor;
+        float diagonalFactor;
+    };
+
+    // Fills weights (0 in every lane that is not a candidate) and returns the candidate mask.
+    // Uses the best kernel the CPU supports (detected once at first use).
+    static unsigned weigh(const Lanes& lanes, const Rule& rule, float weights[Directions::COUNT]);
+    // Same with an explicit kernel, for benchmarking and verification (unsupported ones fall back to the best)
+    static unsigned weigh(Kernel kernel, const Lanes& lanes, const Rule& rule, float weights[Directions::COUNT]);
+
+    // Sum of the weights, added in direction order
+    static float total(const float weights[Directions::COUNT]);
+    // First candidate whose running weight sum reaches randomPick, or -1 if none does
+    static int pick(const float weights[Directions::COUNT], unsigned candidates, float randomPick);
+    // Candidate with the largest weight (the first one on ties), or -1 without candidates
+    static int heaviest(const float weights[Directions::COUNT], unsigned candidates);
+
+    // Number of set lanes, and the direction of the n-th (from 0, in direction order)
+    static int count(unsigned lanes);
+    static int nth(unsigned lanes, int n);
+
+    static Kernel bestAvailableKernel();
+    static bool isSupported(Kernel kernel);
+    static const char* kernelName(Kernel kernel);
+};
+
+#endif // DECISION_KERNELS_HPP
@@ -0,0 +1,83 @@
+// AntSimulation - An SFML simulation of an ant colony.
+// Copyright (C) 2025 Logan Herrera <jherre36@live.nmhu.edu>
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+
+#ifndef DIRECTIONS_HPP
+#define DIRECTIONS_HPP
+
+#include <cstdint>
+
+// The 8 movement directions shared by the ants and the grids: 0 = N, then clockwise NE, E, SE, S, SW, W, NW.
+// Per-direction state is passed around as 8-bit masks (bit d = direction d), so the neighbour scans in the
+// ant kernels test one precomputed mask instead of bounds checking every neighbour.
+namespace Directions {
+
+constexpr int COUNT = 8;
+constexpr int DX[COUNT] = { 0, 1, 1, 1, 0, -1, -1, -1 };
+constexpr int DY[COUNT] = { -1, -1, 0, 1, 1, 1, 0, -1 };
+
+// Directions that leave the world through each edge
+constexpr unsigned LEFT_EDGE = (1u << 5) | (1u << 6) | (1u << 7);   // SW, W, NW
+constexpr unsigned RIGHT_EDGE = (1u << 1) | (1u << 2) | (1u << 3);  // NE, E, SE
+constexpr unsigned TOP_EDGE = (1u << 7) | (1u << 0) | (1u << 1);    // NW, N, NE
+constexpr unsigned BOTTOM_EDGE = (1u << 3) | (1u << 4) | (1u << 5); // SE, S, SW
+
+// Boundary-mask table: entry (left | right << 1 | top << 2 | bottom << 3), one bit per edge the cell
+// touches, lists the directions that stay inside the world
+struct InsideTable {
+    std::uint8_t masks[16];
+
+    constexpr InsideTable() : masks{} {
+        for (unsigned edges = 0; edges < 16; ++edges) {
+            unsigned mask = 0xFFu;
+            if (edges & 1u) mask &= ~LEFT_EDGE;
+            if (edges & 2u) mask &= ~RIGHT_EDGE;
+            if (edges & 4u) mask &= ~TOP_EDGE;
+            if (edges & 8u) mask &= ~BOTTOM_EDGE;
+            masks[edges] = static_cast<std::uint8_t>(mask);
+        }
+    }
+};
+constexpr InsideTable INSIDE_TABLE{};
+
+// Directions whose neighbour of the in-bounds cell (x, y) is still inside a width x height world.
+// Four comparisons per cell, then one table load, instead of four comparisons per neighbour.
+inline unsigned insideMask(int x, int y, int width, int height) {
+    const unsigned edges = static_cast<unsigned>(x == 0)
+        | (static_cast<unsigned>(x == width - 1) << 1)
+        | (static_cast<unsigned>(y == 0) << 2)
+        | (static_cast<unsigned>(y == height - 1) << 3);
+    return INSIDE_TABLE.masks[edges];
+}
+
+// Bit of the direction leading from (x, y) to (toX, toY), or 0 when that cell is not one of its 8 neighbours
+inline unsigned directionBit(int x, int y, int toX, int toY) {
+    constexpr std::uint8_t BITS[3][3] = {
+        { 1u << 7, 1u << 0, 1u << 1 },  // NW, N, NE
+        { 1u << 6, 0,       1u << 2 },  // W, (same cell), E
+        { 1u << 5, 1u << 4, 1u << 3 },  // SW, S, SE
+    };
+    const int dx = toX - x;
+    const int dy = toY - y;
+    if (dx < -1 || dx > 1 || dy < -1 || dy > 1) {
+        return 0;
+    }
+    return BITS[dy + 1][dx + 1];
+}
+
+} // namespace Directions
+
+#endif // DIRECTIONS_HPP
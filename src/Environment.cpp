@@ -17,18 +17,32 @@
 #include "Environment.hpp"
 #include "RandomUtils.hpp"
 #include <iostream>
-#include <random> // For std::uniform_int_distribution, std::uniform_real_distribution
 #include <cmath> // For std::sqrt, std::cos, std::sin
+#include <algorithm>
 
 #ifndef M_PI
 #define M_PI 3.14159265358979323846
 #endif
 
-// Constructor
-Environment::Environment(float cellSizeVal) : cellSize(cellSizeVal), 
+void FoodChunk::clear() {
+    std::fill(amount, amount + TileShape::CELLS, 0u);
+    foodCells = 0;
+}
+
+// Constructor (only the chosen storage is allocated)
+Environment::Environment(float cellSizeVal, int gridWidth, int gridHeight, WorldStorage storage) : cellSize(cellSizeVal),
+width(gridWidth),
+height(gridHeight),
 totalFoodSources(0),
-foodGrid(GRID_SIZE, std::vector<unsigned int>(GRID_SIZE, 0)) {
-    generateFood(); // Place initial food sources
+m_storage(storage),
+m_foodRevision(0) {
+    if (storage == WorldStorage::Dense) {
+        m_foodGrid = Grid<unsigned int>(gridWidth, gridHeight, 0);
+    }
+    else {
+        m_foodTiles = TiledGrid<FoodChunk>(gridWidth, gridHeight);
+    }
+    m_foodIndex = FoodIndex(gridWidth, gridHeight, storage == WorldStorage::Dense);
 }
 
 // Destructor
@@ -38,31 +52,31 @@ Environment::~Environment()
 }
 
 // Generate Random Food Sources
-void Environment::generateFood() {
+void Environment::generateFood(CounterRng& rng) {
     // Clear existing food first
-    for (int i = 0; i < GRID_SIZE; i++) {
-        for (int j = 0; j < GRID_SIZE; j++) {
-            foodGrid[i][j] = 0;
-        }
+    if (m_storage == WorldStorage::Dense) {
+        m_foodGrid.fill(0);
+    }
+    else {
+        m_foodTiles.releaseAll();
     }
+    m_foodIndex.clear();
     totalFoodSources = 0; // Reset count when regenerating food
-
-    std::uniform_int_distribution<> distrib_coord(0, GRID_SIZE - 1);
-    std::uniform_real_distribution<float> distrib_angle(0.0f, 2.0f * static_cast<float>(M_PI));
-    std::uniform_real_distribution<float> distrib_radius_factor(0.0f, 1.0f);
-
+    m_foodRevision++; // The food layer rebuilds from scratch
+    m_placedFoodCells.clear();
+    m_depletedFoodCells.clear();
 
     for (int c = 0; c < NUM_CLUMPS; ++c) {
         if (totalFoodSources >= INITIAL_FOOD_SOURCES && INITIAL_FOOD_SOURCES > 0) break;
 
-        int clumpCenterX = distrib_coord(RandomUtils::getGenerator());
-        int clumpCenterY = distrib_coord(RandomUtils::getGenerator());
+        int clumpCenterX = rng.upTo(width - 1);
+        int clumpCenterY = rng.upTo(height - 1);
 
         for (int attempt = 0; attempt < ATTEMPTS_PER_CLUMP; ++attempt) {
             if (totalFoodSources >= INITIAL_FOOD_SOURCES && INITIAL_FOOD_SOURCES > 0) break;
 
-            float angle = distrib_angle(RandomUtils::getGenerator());
-            float radius_factor = distrib_radius_factor(RandomUtils::getGenerator());
+            float angle = rng.uniform(0.0f, 2.0f * static_cast<float>(M_PI));
+            float radius_factor = rng.uniform();
             float radius = CLUMP_RADIUS * radius_factor * radius_factor;
 
             int offsetX = static_cast<int>(std::round(radius * std::cos(angle)));
@@ -71,9 +85,20 @@ void Environment::generateFood() {
             int foodX = clumpCenterX + offsetX;
             int foodY = clumpCenterY + offsetY;
 
-            if (foodX >= 0 && foodX < GRID_SIZE && foodY >= 0 && foodY < GRID_SIZE) {
-                if (foodGrid[foodX][foodY] == 0) { // Only place if the cell is empty
-                    foodGrid[foodX][foodY] = INITIAL_FOOD_PER_SOURCE; // Set initial food quantity
+            if (inBounds(foodX, foodY)) {
+                if (foodAt(foodX, foodY) == 0) { // Only place if the cell is empty
+                    // Set initial food quantity
+                    if (m_storage == WorldStorage::Dense) {
+                        m_foodGrid(foodX, foodY) = INITIAL_FOOD_PER_SOURCE;
+                    }
+                    else {
+                        FoodChunk& chunk = m_foodTiles.obtain(foodX, foodY);
+                        chunk.amount[TileShape::cellInChunk(foodX, foodY)] = INITIAL_FOOD_PER_SOURCE;
+                        chunk.foodCells++;
+                    }
+                    const std::uint64_t cell = static_cast<std::uint64_t>(foodY) * width + foodX;
+                    m_placedFoodCells.push_back(cell);
+                    m_foodIndex.add(foodX, foodY, cell);
                     totalFoodSources++;
                 }
             }
@@ -82,54 +107,94 @@ void Environment::generateFood() {
     //std::cout << "Total distinct food sources placed: " << totalFoodSources << std::endl;
 }
 
+// Food left at a Given Grid Location (cells of an unallocated chunk are empty)
+unsigned int Environment::foodAt(int x, int y) const {
+    if (!inBounds(x, y)) {
+        return 0;
+    }
+    if (m_storage == WorldStorage::Dense) {
+        return m_foodGrid(x, y);
+    }
+    const FoodChunk* chunk = m_foodTiles.find(x, y);
+    return chunk != nullptr ? chunk->amount[TileShape::cellInChunk(x, y)] : 0;
+}
+
 // Check if Food Exists at a Given Grid Location (for quantity > 0)
-bool Environment::checkForFood(int x, int y) {
-    if (x >= 0 && x < GRID_SIZE && y >= 0 && y < GRID_SIZE) {
-        return foodGrid[x][y] > 0; // Food exists if quantity is greater than 0
+bool Environment::checkForFood(int x, int y) const {
+    return foodAt(x, y) > 0; // Food exists if quantity is greater than 0
+}
+
+unsigned int Environment::foodAround(int x, int y) const {
+    if (m_foodIndex.hasBitmap()) {
+        return m_foodIndex.neighbourhood(x, y);
     }
-    return false;
+    // Tiled worlds have no full-map bitmap; nine lookups, most of which hit an unallocated chunk
+    unsigned int around = 0;
+    for (int dy = -1; dy <= 1; ++dy) {
+        for (int dx = -1; dx <= 1; ++dx) {
+            if (foodAt(x + dx, y + dy) > 0) {
+                around |= foodAroundBit(dx, dy);
+            }
+        }
+    }
+    return around;
 }
 
 // Remove Food When an Ant Takes It from a Given Grid Location (decrements quantity)
 void Environment::removeFood(int x, int y) {
-    if (x >= 0 && x < GRID_SIZE && y >= 0 && y < GRID_SIZE) {
-        if (foodGrid[x][y] > 0) { // Check if food exists before removing
-			foodGrid[x][y]--;   // Decrement food quantity by 1 at the specified location
-            if (foodGrid[x][y] == 0) { // If source is fully depleted
-                totalFoodSources--; // Decrement count of existing sources
+    if (!inBounds(x, y)) {
+        return;
+    }
+    if (m_storage == WorldStorage::Dense) {
+        if (m_foodGrid(x, y) > 0) { // Check if food exists before removing
+			m_foodGrid(x, y)--;   // Decrement food quantity by 1 at the specified location
+            if (m_foodGrid(x, y) == 0) { // If source is fully depleted
+                foodDepleted(x, y);
             }
-            // std::cout << "Food decremented at (" << x << ", " << y << "). Remaining: " << foodGrid[x][y] << "\n";
         }
+        return;
     }
-}
-
 
-// Render Food Sources Correctly Using SFML (only renders if food > 0)
-void Environment::renderFood(sf::RenderWindow& window) {
-    for (int i = 0; i < GRID_SIZE; i++) {
-        for (int j = 0; j < GRID_SIZE; j++) {
-            if (foodGrid[i][j] > 0) { // If food is present at grid cell i,j
-                sf::RectangleShape foodShape(sf::Vector2f(cellSize, cellSize));
-                foodShape.setPosition(static_cast<float>(i * cellSize), static_cast<float>(j * cellSize));
-                foodShape.setFillColor(sf::Color::Green);
-                window.draw(foodShape);
+    FoodChunk* chunk = m_foodTiles.find(x, y);
+    if (chunk == nullptr) {
+        return;
+    }
+    unsigned int& food = chunk->amount[TileShape::cellInChunk(x, y)];
+    if (food > 0) {
+        food--;
+        if (food == 0) {
+            foodDepleted(x, y);
+            if (--chunk->foodCells == 0) {
+                m_foodTiles.release(x, y); // Nothing left to find here; the chunk goes back to the pool
             }
         }
     }
 }
 
+void Environment::foodDepleted(int x, int y) {
+    totalFoodSources--; // Decrement count of existing sources
+    const std::uint64_t cell = static_cast<std::uint64_t>(y) * width + x;
+    m_depletedFoodCells.push_back(cell);
+    m_foodIndex.remove(x, y, cell);
+}
+
+size_t Environment::foodMemoryBytes() const {
+    if (m_storage == WorldStorage::Dense) {
+        return m_foodGrid.size() * sizeof(unsigned int) + m_foodIndex.memoryBytes();
+    }
+    return m_foodTiles.memoryBytes() + m_foodIndex.memoryBytes();
+}
 
 // Utility debug function to print current food positions to the console
 void Environment::debugFoodPositions() {
     std::cout << "Current food positions (with quantity):\n";
     bool foodFound = false;
-    for (int x = 0; x < GRID_SIZE; x++) {
-        for (int y = 0; y < GRID_SIZE; y++) {
-            if (foodGrid[x][y] > 0) {
-                std::cout << "  Food at (" << x << ", " << y << ") Qty: " << foodGrid[x][y] << "\n";
-                foodFound = true;
-            }
-        }
+    // The index lists every cell still holding food, so nothing else needs scanning at any world size
+    for (std::uint64_t cell : m_foodIndex.cells()) {
+        const int x = static_cast<int>(cell % static_cast<std::uint64_t>(width));
+        const int y = static_cast<int>(cell / static_cast<std::uint64_t>(width));
+        std::cout << "  Food at (" << x << ", " << y << ") Qty: " << foodAt(x, y) << "\n";
+        foodFound = true;
     }
     if (!foodFound) {
         std::cout << "  No food on the grid.\n";
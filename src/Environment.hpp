@@ -17,14 +17,30 @@
 #ifndef ENVIRONMENT_HPP
 #define ENVIRONMENT_HPP
 
-#include <SFML/Graphics.hpp>
+#include "FoodIndex.hpp"
+#include "Grid.hpp"
+#include "RandomUtils.hpp"
+#include "TiledGrid.hpp"
+#include <cstdint>
 #include <vector>
 
+// One tile of the food layer (Tiled storage). foodCells counts the cells still holding food, so the
+// chunk can go back to the pool the moment its last source is eaten.
+struct FoodChunk {
+    unsigned int amount[TileShape::CELLS];
+    unsigned int foodCells;
+
+    FoodChunk() { clear(); }
+    void clear();
+};
+
 class Environment {
 public:
     float cellSize;
-	static const int GRID_SIZE = 200; // Size of the grid (200x200 cells)
-    std::vector<std::vector<unsigned int>> foodGrid;         // For Food
+    static const int DEFAULT_GRID_SIZE = 200; // Default world size (200x200 cells)
+
+    // World size in cells, chosen at startup
+    int width, height;
 
     // --- Total count of distinct food sources currently on the grid ---
     unsigned int totalFoodSources;
@@ -36,17 +52,54 @@ public:
     static constexpr int ATTEMPTS_PER_CLUMP = (INITIAL_FOOD_SOURCES > 0 && NUM_CLUMPS > 0) ? (INITIAL_FOOD_SOURCES / NUM_CLUMPS) : 20;
     static constexpr float CLUMP_RADIUS = 10.0f;
 
-    // Constructor and destructor
-    Environment(float cellSize);
+    // Constructor and destructor (the grid starts empty; Simulation places food once it has picked the world seed)
+    Environment(float cellSize, int width = DEFAULT_GRID_SIZE, int height = DEFAULT_GRID_SIZE,
+        WorldStorage storage = WorldStorage::Dense);
     ~Environment();
 
+    WorldStorage storage() const { return m_storage; }
+    bool inBounds(int x, int y) const {
+        return x >= 0 && x < width && y >= 0 && y < height;
+    }
+
     // Food methods
-    void generateFood();
-    void renderFood(sf::RenderWindow& window);
-    bool checkForFood(int x, int y);
+    void generateFood(CounterRng& rng);
+    unsigned int foodAt(int x, int y) const; // Food left in a cell (0 out of bounds)
+    bool checkForFood(int x, int y) const;
+    // Food presence in the 3x3 block centred on (x, y), one bit per cell (see foodAroundBit); cells outside
+    // the world read as empty. (x, y) must be in bounds. Dense storage answers from the presence bitmap.
+    unsigned int foodAround(int x, int y) const;
+    static constexpr unsigned int foodAroundBit(int dx, int dy) {
+        return 1u << ((dy + 1) * 3 + (dx + 1));
+    }
+    // Cells (linear indices y * width + x) that still hold food, in no particular order
+    const std::vector<std::uint64_t>& liveFoodCells() const { return m_foodIndex.cells(); }
     void removeFood(int x, int y);
 	// For debugging purposes
     void debugFoodPositions();
+
+    // --- Change tracking for the food layer (see FoodLayer) ---
+    // The revision changes whenever the whole grid is regenerated. Between revisions the only change is
+    // cells running out of food, listed in order. Both lists are bounded by the number of food cells placed.
+    unsigned long long foodRevision() const { return m_foodRevision; }
+    // Cells are linear indices y * width + x.
+    const std::vector<std::uint64_t>& placedFoodCells() const { return m_placedFoodCells; }
+    const std::vector<std::uint64_t>& depletedFoodCells() const { return m_depletedFoodCells; }
+
+    // Bytes held by the food layer and its index
+    size_t foodMemoryBytes() const;
+
+private:
+    WorldStorage m_storage;
+    Grid<unsigned int> m_foodGrid;        // Dense storage (empty when Tiled)
+    TiledGrid<FoodChunk> m_foodTiles;     // Tiled storage (empty when Dense)
+    FoodIndex m_foodIndex;                // Presence bitmap (Dense only) and live cell list for the grid above
+
+    unsigned long long m_foodRevision;
+    std::vector<std::uint64_t> m_placedFoodCells;
+    std::vector<std::uint64_t> m_depletedFoodCells;
+
+    void foodDepleted(int x, int y); // Bookkeeping for a cell whose last unit of food was taken
 };
 
 #endif // ENVIRONMENT_HPP
\ No newline at end of file
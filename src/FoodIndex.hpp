@@ -0,0 +1,121 @@
+// AntSimulation - An SFML simulation of an ant colony.
+// Copyright (C) 2025 Logan Herrera <jherre36@live.nmhu.edu>
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+
+#ifndef FOOD_INDEX_HPP
+#define FOOD_INDEX_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// Where the food is, in two forms that Environment keeps in sync with its food grid:
+//  - a presence bitmap (one bit per cell, set while the cell holds food) with a one-cell empty border,
+//    so the 3x3 neighbourhood of any in-bounds cell is three 3-bit row reads with no bounds checks;
+//  - a compact list of the cells that still hold food, for iteration without scanning the map.
+// The bitmap is optional: a Tiled world is too large for a full-map bitmap and answers from its chunks instead.
+class FoodIndex {
+public:
+    FoodIndex() : m_width(0), m_stride(0), m_hasBitmap(false) {}
+    FoodIndex(int width, int height, bool withBitmap)
+        : m_width(width),
+        m_stride(withBitmap ? static_cast<size_t>(width + 2 + 63) / 64 : 0),
+        m_hasBitmap(withBitmap)
+    {
+        if (withBitmap) {
+            m_bits.assign(m_stride * static_cast<size_t>(height + 2), 0);
+        }
+    }
+
+    bool hasBitmap() const { return m_hasBitmap; }
+
+    // Empties the index. Only the bits of cells still listed can be set, so this is O(live cells).
+    void clear() {
+        if (m_hasBitmap) {
+            const std::uint64_t width = static_cast<std::uint64_t>(m_width);
+            for (std::uint64_t cell : m_cells) {
+                setBit(static_cast<int>(cell % width), static_cast<int>(cell / width), false);
+            }
+        }
+        m_cells.clear();
+    }
+
+    // (x, y) now holds food; cell is its linear index y * width + x
+    void add(int x, int y, std::uint64_t cell) {
+        if (m_hasBitmap) {
+            setBit(x, y, true);
+        }
+        m_cells.push_back(cell);
+    }
+
+    // (x, y) ran out. Depletion happens once per food cell, so a linear search of the short list is fine;
+    // the last entry takes the removed one's place.
+    void remove(int x, int y, std::uint64_t cell) {
+        if (m_hasBitmap) {
+            setBit(x, y, false);
+        }
+        auto it = std::find(m_cells.begin(), m_cells.end(), cell);
+        if (it != m_cells.end()) {
+            *it = m_cells.back();
+            m_cells.pop_back();
+        }
+    }
+
+    // 9-bit presence mask of the 3x3 block centred on (x, y): bit (dy + 1) * 3 + (dx + 1) is cell
+    // (x + dx, y + dy). Needs the bitmap; (x, y) must be in bounds.
+    unsigned int neighbourhood(int x, int y) const {
+        // Padded coordinates: the block's top-left cell (x - 1, y - 1) sits at bit column x of padded row y
+        return rowBits(y, x) | (rowBits(y + 1, x) << 3) | (rowBits(y + 2, x) << 6);
+    }
+
+    // Cells holding food (linear indices), in no particular order
+    const std::vector<std::uint64_t>& cells() const { return m_cells; }
+    size_t size() const { return m_cells.size(); }
+
+    size_t memoryBytes() const {
+        return m_bits.size() * sizeof(std::uint64_t) + m_cells.capacity() * sizeof(std::uint64_t);
+    }
+
+private:
+    int m_width;
+    size_t m_stride;                   // 64-bit words per padded row
+    bool m_hasBitmap;
+    std::vector<std::uint64_t> m_bits; // (height + 2) padded rows of (width + 2) bits
+    std::vector<std::uint64_t> m_cells;
+
+    void setBit(int x, int y, bool value) {
+        const size_t bit = static_cast<size_t>(x + 1);
+        std::uint64_t& word = m_bits[static_cast<size_t>(y + 1) * m_stride + (bit >> 6)];
+        const std::uint64_t mask = std::uint64_t(1) << (bit & 63);
+        word = value ? (word | mask) : (word & ~mask);
+    }
+
+    // Bits firstBit .. firstBit + 2 of a padded row. The three bits can straddle two words; the row
+    // always has room for the second one because the right border column is part of it.
+    unsigned int rowBits(int paddedRow, int firstBit) const {
+        const std::uint64_t* row = &m_bits[static_cast<size_t>(paddedRow) * m_stride];
+        const int word = firstBit >> 6;
+        const int shift = firstBit & 63;
+        std::uint64_t bits = row[word] >> shift;
+        if (shift > 61) {
+            bits |= row[word + 1] << (64 - shift);
+        }
+        return static_cast<unsigned int>(bits & 7u);
+    }
+};
+
+#endif // FOOD_INDEX_HPP
@@ -0,0 +1,92 @@
+// AntSimulation - An SFML simulation of an ant colony.
+// Copyright (C) 2025 Logan Herrera <jherre36@live.nmhu.edu>
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#include "FoodLayer.hpp"
+#include <algorithm>
+#include <iostream>
+
+// Food cells use the same solid green as the old per-cell squares
+static const sf::Color FOOD_COLOR = sf::Color::Green;
+
+// Constructor
+FoodLayer::FoodLayer(int width, int height, float cellSize)
+    : m_width(width),
+    m_height(height),
+    m_cellSize(cellSize),
+    m_textureReady(false),
+    m_revision(0),
+    m_appliedDepleted(0)
+{
+    // Same limit as the pheromone overlay: no full-map pixel buffer for a map that cannot be uploaded
+    const unsigned maxSize = sf::Texture::getMaximumSize();
+    if (static_cast<unsigned>(width) > maxSize || static_cast<unsigned>(height) > maxSize) {
+        std::cerr << "Warning: a " << width << "x" << height << " map exceeds the " << maxSize
+            << " pixel texture limit; food will not be drawn.\n";
+        return;
+    }
+    m_pixels.assign(static_cast<size_t>(width) * height * 4, 0);
+    m_textureReady = m_texture.create(static_cast<unsigned>(width), static_cast<unsigned>(height));
+    if (!m_textureReady) {
+        std::cerr << "Warning: could not create a " << width << "x" << height
+            << " food texture; food will not be drawn.\n";
+    }
+}
+
+void FoodLayer::clearCell(std::uint64_t cell) {
+    std::uint8_t* pixel = &m_pixels[static_cast<size_t>(cell) * 4];
+    pixel[0] = pixel[1] = pixel[2] = pixel[3] = 0;
+}
+
+void FoodLayer::update(const FoodSnapshot& food) {
+    if (!m_textureReady) {
+        return;
+    }
+
+    if (m_revision != food.revision) {
+        // New world: repaint everything from the placed cells, then clear the ones already eaten
+        std::fill(m_pixels.begin(), m_pixels.end(), static_cast<std::uint8_t>(0));
+        for (std::uint64_t cell : food.placedCells) {
+            std::uint8_t* pixel = &m_pixels[static_cast<size_t>(cell) * 4];
+            pixel[0] = FOOD_COLOR.r; pixel[1] = FOOD_COLOR.g; pixel[2] = FOOD_COLOR.b; pixel[3] = FOOD_COLOR.a;
+        }
+        for (std::uint64_t cell : food.depletedCells) {
+            clearCell(cell);
+        }
+        m_texture.update(m_pixels.data());
+        m_revision = food.revision;
+        m_appliedDepleted = food.depletedCells.size();
+        return;
+    }
+
+    // Cells that ran out since the last update become transparent; each is a 1x1 upload, and there are only a few per frame
+    for (size_t i = m_appliedDepleted; i < food.depletedCells.size(); ++i) {
+        const std::uint64_t cell = food.depletedCells[i];
+        clearCell(cell);
+        m_texture.update(&m_pixels[static_cast<size_t>(cell) * 4], 1, 1,
+            static_cast<unsigned>(cell % static_cast<std::uint64_t>(m_width)),
+            static_cast<unsigned>(cell / static_cast<std::uint64_t>(m_width)));
+    }
+    m_appliedDepleted = food.depletedCells.size();
+}
+
+void FoodLayer::draw(sf::RenderTarget& target) const {
+    if (!m_textureReady) {
+        return;
+    }
+    sf::Sprite sprite(m_texture);
+    sprite.setScale(m_cellSize, m_cellSize);
+    target.draw(sprite);
+}
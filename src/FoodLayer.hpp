@@ -0,0 +1,48 @@
+// AntSimulation - An SFML simulation of an ant colony.
+// Copyright (C) 2025 Logan Herrera <jherre36@live.nmhu.edu>
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#ifndef FOOD_LAYER_HPP
+#define FOOD_LAYER_HPP
+
+#include "WorldSnapshot.hpp"
+#include <SFML/Graphics.hpp>
+#include <cstdint>
+#include <vector>
+
+// Cached drawing of the food grid: one opaque green texel per cell holding food, scaled to the cell size.
+// Food only changes when a cell is emptied or the world is regenerated, so after the first build only the
+// cells that ran out since the last update are patched; the cost per frame follows how much food changed.
+class FoodLayer {
+public:
+    FoodLayer(int width, int height, float cellSize);
+
+    // Brings the texture up to date with the snapshot (full rebuild for a new world, otherwise new depleted cells only)
+    void update(const FoodSnapshot& food);
+    void draw(sf::RenderTarget& target) const;
+
+private:
+    int m_width, m_height;
+    float m_cellSize;
+    bool m_textureReady;
+    unsigned long long m_revision; // Food revision the texture was built from
+    size_t m_appliedDepleted;      // Entries of FoodSnapshot::depletedCells already cleared in the texture
+    sf::Texture m_texture;
+    std::vector<std::uint8_t> m_pixels; // RGBA, row-major, mirrors the texture
+
+    void clearCell(std::uint64_t cell);
+};
+
+#endif // FOOD_LAYER_HPP
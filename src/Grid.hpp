@@ -0,0 +1,93 @@
+// AntSimulation - An SFML simulation of an ant colony.
+// Copyright (C) 2025 Logan Herrera <jherre36@live.nmhu.edu>
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#ifndef GRID_HPP
+#define GRID_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <new>
+#include <vector>
+
+// Minimal allocator that hands out memory aligned to ALIGNMENT bytes, so grid rows start on
+// cache line boundaries and SIMD loads over the whole buffer can use aligned accesses.
+template <typename T, std::size_t ALIGNMENT = 64>
+struct AlignedAllocator {
+    using value_type = T;
+
+    template <typename U>
+    struct rebind { using other = AlignedAllocator<U, ALIGNMENT>; };
+
+    AlignedAllocator() noexcept = default;
+    template <typename U>
+    AlignedAllocator(const AlignedAllocator<U, ALIGNMENT>&) noexcept {}
+
+    T* allocate(std::size_t count) {
+        return static_cast<T*>(::operator new(count * sizeof(T), std::align_val_t(ALIGNMENT)));
+    }
+    void deallocate(T* ptr, std::size_t) noexcept {
+        ::operator delete(ptr, std::align_val_t(ALIGNMENT));
+    }
+
+    template <typename U>
+    bool operator==(const AlignedAllocator<U, ALIGNMENT>&) const noexcept { return true; }
+    template <typename U>
+    bool operator!=(const AlignedAllocator<U, ALIGNMENT>&) const noexcept { return false; }
+};
+
+// Contiguous 2D grid stored row-major: cell (x, y) lives at data()[y * width + x].
+// Replaces the old std::vector<std::vector<T>> grids, which cost one heap row per column and an
+// extra pointer chase on every access. The size is chosen at runtime.
+template <typename T>
+class Grid {
+public:
+    Grid() : m_width(0), m_height(0) {}
+    Grid(int width, int height, const T& initialValue = T())
+        : m_width(width), m_height(height), m_cells(static_cast<std::size_t>(width) * height, initialValue) {}
+
+    int width() const { return m_width; }
+    int height() const { return m_height; }
+    std::size_t size() const { return m_cells.size(); }
+
+    bool inBounds(int x, int y) const {
+        return x >= 0 && x < m_width && y >= 0 && y < m_height;
+    }
+
+    std::size_t index(int x, int y) const {
+        return static_cast<std::size_t>(y) * m_width + x;
+    }
+
+    // Unchecked access, callers are expected to bounds check with inBounds()
+    T& operator()(int x, int y) { return m_cells[index(x, y)]; }
+    const T& operator()(int x, int y) const { return m_cells[index(x, y)]; }
+
+    T& operator[](std::size_t i) { return m_cells[i]; }
+    const T& operator[](std::size_t i) const { return m_cells[i]; }
+
+    T* data() { return m_cells.data(); }
+    const T* data() const { return m_cells.data(); }
+
+    void fill(const T& value) {
+        std::fill(m_cells.begin(), m_cells.end(), value);
+    }
+
+private:
+    int m_width;
+    int m_height;
+    std::vector<T, AlignedAllocator<T>> m_cells;
+};
+
+#endif // GRID_HPP
@@ -0,0 +1,124 @@
+// AntSimulation - An SFML simulation of an ant colony.
+// Copyright (C) 2025 Logan Herrera <jherre36@live.nmhu.edu>
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#include "Headless.hpp"
+#include "Profiler.hpp"
+#include "Simulation.hpp"
+#include <chrono>
+#include <iostream>
+
+// Cell size only affects drawing, which never happens in headless mode
+static constexpr float HEADLESS_CELL_SIZE = 1.0f;
+
+// Prints the hardware counters of every timed phase per call and per ant-tick (one ant updated once)
+static void printPerfReport(unsigned long long antTicks) {
+#ifndef ANTSIM_PROFILING
+    std::cout << "Hardware counters: this build has profiling compiled out (configure with -DANTSIM_PROFILING=ON).\n";
+    (void)antTicks;
+#else
+    const PerfCounters& counters = PerfCounters::forThisThread();
+    if (!counters.available()) {
+        std::cout << "Hardware counters unavailable (" << counters.reason() << "); timers only.\n";
+        return;
+    }
+    if (!counters.reason().empty()) {
+        std::cout << "Some hardware counters unavailable: " << counters.reason() << "\n";
+    }
+    std::cout << "Hardware counters per phase (counted on the thread that ran it; per ant = per ant updated once):\n";
+    for (const ProfileStats& s : Profiler::instance().stats()) {
+        if (s.counterCalls == 0) {
+            continue;
+        }
+        const auto perCall = [&](PerfEvent e) { return static_cast<double>(s.counterTotals.value[e]) / s.counterCalls; };
+        const auto perAnt = [&](PerfEvent e) { return antTicks > 0 ? static_cast<double>(s.counterTotals.value[e]) / antTicks : 0.0; };
+        const double cycles = static_cast<double>(s.counterTotals.value[PERF_CYCLES]);
+        std::cout << "  " << s.name << " (" << s.counterCalls << " calls)";
+        if (cycles > 0.0 && counters.has(PERF_INSTRUCTIONS)) {
+            std::cout << "  IPC " << s.counterTotals.value[PERF_INSTRUCTIONS] / cycles;
+        }
+        std::cout << "\n    per call:";
+        for (int e = 0; e < PERF_EVENT_COUNT; ++e) {
+            if (counters.has(static_cast<PerfEvent>(e))) {
+                std::cout << "  " << PerfCounters::eventName(static_cast<PerfEvent>(e)) << " " << static_cast<long long>(perCall(static_cast<PerfEvent>(e)));
+            }
+        }
+        std::cout << "\n    per ant: ";
+        for (int e = 0; e < PERF_EVENT_COUNT; ++e) {
+            if (counters.has(static_cast<PerfEvent>(e))) {
+                std::cout << "  " << PerfCounters::eventName(static_cast<PerfEvent>(e)) << " " << perAnt(static_cast<PerfEvent>(e));
+            }
+        }
+        std::cout << "\n";
+    }
+#endif
+}
+
+int runHeadless(const SimulationOptions& options) {
+    TraceRecorder::setThreadName("simulation");
+    if (!options.traceFile.empty()) {
+        TraceRecorder::instance().start(options.traceFile);
+    }
+    PerfCounters::setEnabled(options.perfCounters);
+    Simulation sim(options, HEADLESS_CELL_SIZE);
+    ProfileLog profileLog(options.profileLog);
+
+    unsigned long long resets = 0;
+    unsigned long long antTicks = 0; // Ants updated, summed over ticks (the per-ant divisor of the counter report)
+    unsigned long long ticksRun = 0;
+    const auto start = std::chrono::steady_clock::now();
+
+    std::cout << "Running headless simulation on a " << options.gridWidth << "x" << options.gridHeight << " world ("
+        << (options.decayMode == PheromoneDecayMode::Lazy ? "lazy" : "eager") << " decay, "
+        << (options.worldStorage == WorldStorage::Tiled ? "tiled" : "dense") << " storage, "
+        << (options.pheromoneLayout == PheromoneLayout::Interleaved ? "interleaved half-float pheromones, " : "")
+        << (options.threads == 1 ? std::string("serial") : std::to_string(options.threads == 0 ? ThreadPool::hardwareThreads() : options.threads) + " threads") << ")"
+        << (options.maxTicks > 0 ? " for " + std::to_string(options.maxTicks) + " ticks" : std::string(" until stopped"))
+        << ", seed " << options.seed << "...\n";
+
+    while (options.maxTicks == 0 || ticksRun < options.maxTicks) {
+        antTicks += static_cast<unsigned long long>(sim.totalLiveAnts());
+        sim.step();
+        ticksRun++;
+
+        // Same reset condition as the windowed loop, minus the countdown
+        if (sim.isFinished()) {
+            sim.reset();
+            resets++;
+        }
+        profileLog.maybeWrite();
+
+        if (options.reportEvery > 0 && ticksRun % options.reportEvery == 0) {
+            const double elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+            std::cout << "tick " << ticksRun
+                << "  live ants " << sim.totalLiveAnts()
+                << "  food sources " << sim.env.totalFoodSources
+                << "  pheromone cells " << sim.activePheromoneCells()
+                << "  resets " << resets
+                << "  " << static_cast<long long>(ticksRun / (elapsed > 0.0 ? elapsed : 1e-9)) << " ticks/sec\n";
+        }
+    }
+
+    profileLog.write();
+    TraceRecorder::instance().stop();
+    const double elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    std::cout << "Finished " << ticksRun << " ticks in " << elapsed << " s ("
+        << (elapsed > 0.0 ? ticksRun / elapsed : 0.0) << " ticks/sec, " << resets << " resets).\n";
+    std::cout << "World grids hold " << sim.worldMemoryBytes() / 1024 << " KiB.\n";
+    if (options.perfCounters) {
+        printPerfReport(antTicks);
+    }
+    return 0;
+}
@@ -0,0 +1,69 @@
+// AntSimulation - An SFML simulation of an ant colony.
+// Copyright (C) 2025 Logan Herrera <jherre36@live.nmhu.edu>
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+
+#include "HomeField.hpp"
+#include <algorithm>
+#include <cmath>
+
+HomeField::HomeField(int homeX, int homeY, int worldWidth, int worldHeight)
+    : m_homeX(homeX),
+    m_homeY(homeY),
+    m_originX(0),
+    m_originY(0)
+{
+    const int radius = std::min(MAX_RADIUS, std::max(worldWidth, worldHeight));
+    m_originX = std::max(0, homeX - radius);
+    m_originY = std::max(0, homeY - radius);
+    const int endX = std::min(worldWidth, homeX + radius + 1);
+    const int endY = std::min(worldHeight, homeY + radius + 1);
+    const int tableWidth = std::max(0, endX - m_originX);
+    const int tableHeight = std::max(0, endY - m_originY);
+    m_distance = Grid<float>(tableWidth, tableHeight, 0.0f);
+    m_direction = Grid<std::uint8_t>(tableWidth, tableHeight, AT_HOME);
+
+    for (int localY = 0; localY < tableHeight; ++localY) {
+        const int y = m_originY + localY;
+        for (int localX = 0; localX < tableWidth; ++localX) {
+            const int x = m_originX + localX;
+            m_distance(localX, localY) = computeDistance(x - homeX, y - homeY);
+            m_direction(localX, localY) = computeDirection(homeX - x, homeY - y);
+        }
+    }
+}
+
+// The value the ants used to compute with sqrt(pow(dx, 2) + pow(dy, 2)): squaring an int in double is exact,
+// just like pow(dx, 2), so table lookups change no decision
+float HomeField::computeDistance(int dx, int dy) {
+    const double squared = static_cast<double>(dx) * dx + static_cast<double>(dy) * dy;
+    return std::sqrt(static_cast<float>(squared));
+}
+
+std::uint8_t HomeField::computeDirection(int deltaX, int deltaY) {
+    if (deltaX > 0) { // Need to move East, SE, or NE
+        if (deltaY > 0) return 3;      // Southeast
+        if (deltaY < 0) return 1;      // Northeast
+        return 2;                      // East
+    }
+    if (deltaX < 0) { // Need to move West, SW, or NW
+        if (deltaY > 0) return 5;      // Southwest
+        if (deltaY < 0) return 7;      // Northwest
+        return 6;                      // West
+    }
+    if (deltaY > 0) return 4;          // South
+    if (deltaY < 0) return 0;          // North
+    return AT_HOME;
+}
@@ -0,0 +1,80 @@
+// AntSimulation - An SFML simulation of an ant colony.
+// Copyright (C) 2025 Logan Herrera <jherre36@live.nmhu.edu>
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+
+#ifndef HOME_FIELD_HPP
+#define HOME_FIELD_HPP
+
+#include "Directions.hpp"
+#include "Grid.hpp"
+#include <cstddef>
+#include <cstdint>
+
+// Distance to a colony's home cell and the 8-way step toward it, precomputed for every cell around home.
+// A colony's home never moves, so Colony builds this once in its constructor (a reset builds new colonies)
+// and its ants look values up instead of calling sqrt/pow up to ten times per step.
+// The table covers the world within MAX_RADIUS cells of home (never more than the world itself, so a small
+// world gets a small table). An ant moves at most one cell per tick and lives about Ant::MAX_LIFESPAN ticks,
+// so lookups outside it are rare; they compute the same values directly.
+class HomeField {
+public:
+    static constexpr int MAX_RADIUS = 1024;
+    static constexpr std::uint8_t AT_HOME = 8; // homeDirection() of the home cell itself
+
+    HomeField() : m_homeX(0), m_homeY(0), m_originX(0), m_originY(0) {}
+    HomeField(int homeX, int homeY, int worldWidth, int worldHeight);
+
+    // Euclidean distance from (x, y) to home, bit-identical to computing it in place
+    float distance(int x, int y) const {
+        const int localX = x - m_originX;
+        const int localY = y - m_originY;
+        if (m_distance.inBounds(localX, localY)) {
+            return m_distance(localX, localY);
+        }
+        return computeDistance(x - m_homeX, y - m_homeY);
+    }
+
+    // distance() of each of the 8 neighbours of (x, y), in direction order
+    void gatherDistances(int x, int y, float distances[Directions::COUNT]) const {
+        for (int d = 0; d < Directions::COUNT; ++d) {
+            distances[d] = distance(x + Directions::DX[d], y + Directions::DY[d]);
+        }
+    }
+
+    // Direction (0-7: N, NE, E, SE, S, SW, W, NW) of the step from (x, y) toward home, or AT_HOME
+    int homeDirection(int x, int y) const {
+        const int localX = x - m_originX;
+        const int localY = y - m_originY;
+        if (m_direction.inBounds(localX, localY)) {
+            return m_direction(localX, localY);
+        }
+        return computeDirection(m_homeX - x, m_homeY - y);
+    }
+
+    static float computeDistance(int dx, int dy);
+    static std::uint8_t computeDirection(int deltaX, int deltaY); // Step toward (deltaX, deltaY) away
+
+    // Bytes held by the distance and direction tables
+    size_t memoryBytes() const { return m_distance.size() * sizeof(float) + m_direction.size() * sizeof(std::uint8_t); }
+
+private:
+    int m_homeX, m_homeY;
+    int m_originX, m_originY; // World position of the tables' (0, 0)
+    Grid<float> m_distance;
+    Grid<std::uint8_t> m_direction;
+};
+
+#endif // HOME_FIELD_HPP
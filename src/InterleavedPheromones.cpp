@@ -0,0 +1,47 @@
+// AntSimulation - An SFML simulation of an ant colony.
+// Copyright (C) 2025 Logan Herrera <jherre36@live.nmhu.edu>
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+
+#include "InterleavedPheromones.hpp"
+#include "PheromoneKernels.hpp"
+
+// Constructor (the border cells are never written, so they read as empty forever)
+InterleavedPheromones::InterleavedPheromones(int width, int height)
+    : m_cells(width + 2, height + 2, Cell{}),
+    m_nextStep(0)
+{
+}
+
+void InterleavedPheromones::clear() {
+    m_cells.fill(Cell{});
+    m_nextStep.store(0, std::memory_order_relaxed);
+}
+
+// Cells are plain arrays of halves, so the whole grid decays as one flat buffer; channels no colony uses
+// stay at zero
+void InterleavedPheromones::decay(float rate, float threshold) {
+    PheromoneKernels::decayHalf(reinterpret_cast<std::uint16_t*>(m_cells.data()), m_cells.size() * CHANNELS, rate, threshold);
+}
+
+void InterleavedPheromones::decayStep(unsigned long long step, float rate, float threshold) {
+    unsigned long long next = m_nextStep.load(std::memory_order_acquire);
+    while (step >= next) {
+        if (m_nextStep.compare_exchange_weak(next, step + 1, std::memory_order_acq_rel)) {
+            decay(rate, threshold);
+            return;
+        }
+    }
+}
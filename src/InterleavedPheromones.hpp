@@ -0,0 +1,81 @@
+// AntSimulation - An SFML simulation of an ant colony.
+// Copyright (C) 2025 Logan Herrera <jherre36@live.nmhu.edu>
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+
+#ifndef INTERLEAVED_PHEROMONES_HPP
+#define INTERLEAVED_PHEROMONES_HPP
+
+#include "Grid.hpp"
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+// How the colonies' pheromone trails are laid out in memory (chosen at startup with --pheromone-layout)
+enum class PheromoneLayout {
+    Separate,   // Every colony owns a float "food" and "home" grid (Dense or Tiled storage)
+    Interleaved // One world grid shared by all colonies; each cell holds every colony's trails as half floats
+};
+
+// The world-wide grid behind PheromoneLayout::Interleaved.
+// Cell (x, y) packs the food and home levels of up to MAX_COLONIES colonies into 16 bytes, so reading a
+// neighbourhood brings in every colony's trails from the same cache lines one float grid would need, and
+// decay is a single streaming pass over one buffer instead of two sweeps per colony.
+// Levels are half floats (see PheromoneKernels::floatToHalf): they cover the float grids' whole range, from
+// ZERO_THRESHOLD to MAX_LEVEL, to about 3 significant digits, so trails last as long as they do with the
+// float grids. A linear 16-bit scale would lose everything under ~0.008 and cut trail life by almost half.
+// Like the dense float grids it is (width + 2) x (height + 2) with an empty border, so padded indices and
+// neighbour offsets are the same. Each colony reads and writes only its own channels, through its
+// PheromoneField (which also converts to and from real levels). Every PheromoneField::decay on the grid
+// requests the same decay step; the first request sweeps the whole grid and the rest find it done.
+class InterleavedPheromones {
+public:
+    static constexpr int MAX_COLONIES = 4;
+    static constexpr int CHANNELS = 2 * MAX_COLONIES;
+
+    struct alignas(16) Cell {
+        std::uint16_t channel[CHANNELS]; // Half floats; foodChannel(c) and homeChannel(c) for colony c
+    };
+
+    static constexpr int foodChannel(int colony) { return 2 * colony; }
+    static constexpr int homeChannel(int colony) { return 2 * colony + 1; }
+
+    InterleavedPheromones(int width, int height);
+
+    int paddedWidth() const { return m_cells.width(); }
+    size_t cellCount() const { return m_cells.size(); }
+    Cell* data() { return m_cells.data(); }
+    const Cell* data() const { return m_cells.data(); }
+
+    // Zeroes every channel and restarts the decay steps (a new world)
+    void clear();
+
+    // Advances decay by one tick for every colony at once, with the same rule as the float grids
+    void decay(float rate, float threshold);
+    // Decay step number step (counted from 0 by each colony): the first request for it runs decay and later
+    // ones return at once, so the grid fades once a tick whether the colonies are updated one at a time
+    // (Colony::update) or side by side (Simulation::step). Safe to call from several threads.
+    void decayStep(unsigned long long step, float rate, float threshold);
+
+    size_t memoryBytes() const { return m_cells.size() * sizeof(Cell); }
+
+private:
+    Grid<Cell> m_cells;
+    std::atomic<unsigned long long> m_nextStep; // First decay step not applied yet
+};
+
+static_assert(sizeof(InterleavedPheromones::Cell) == 16, "a cell should pack into a quarter cache line");
+
+#endif // INTERLEAVED_PHEROMONES_HPP
@@ -0,0 +1,219 @@
+// AntSimulation - An SFML simulation of an ant colony.
+// Copyright (C) 2025 Logan Herrera <jherre36@live.nmhu.edu>
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#include "Options.hpp"
+#include <iostream>
+#include <random>
+#include <string>
+
+// Reads the value following a flag as an unsigned integer
+static bool readUnsigned(int argc, char* argv[], int& i, unsigned long long& out) {
+    if (i + 1 >= argc) {
+        std::cerr << "Error: " << argv[i] << " expects a value.\n";
+        return false;
+    }
+    const std::string flag = argv[i];
+    const std::string value = argv[++i];
+    try {
+        size_t consumed = 0;
+        out = std::stoull(value, &consumed);
+        if (consumed != value.size()) throw std::invalid_argument(value);
+    }
+    catch (const std::exception&) {
+        std::cerr << "Error: invalid value '" << value << "' for " << flag << ".\n";
+        return false;
+    }
+    return true;
+}
+
+// Reads "N" (square world) or "WxH" following --grid-size
+static bool readGridSize(int argc, char* argv[], int& i, int& width, int& height) {
+    if (i + 1 >= argc) {
+        std::cerr << "Error: " << argv[i] << " expects a value.\n";
+        return false;
+    }
+    const std::string value = argv[++i];
+    try {
+        size_t consumed = 0;
+        width = std::stoi(value, &consumed);
+        height = width;
+        if (consumed < value.size()) {
+            if (value[consumed] != 'x' && value[consumed] != 'X') throw std::invalid_argument(value);
+            const std::string rest = value.substr(consumed + 1);
+            height = std::stoi(rest, &consumed);
+            if (consumed != rest.size()) throw std::invalid_argument(value);
+        }
+    }
+    catch (const std::exception&) {
+        width = height = 0;
+    }
+    if (width <= 0 || height <= 0) {
+        std::cerr << "Error: invalid grid size '" << value << "', expected N or WxH.\n";
+        return false;
+    }
+    return true;
+}
+
+// --world-storage auto switches to tiled storage above this many cells (4096 x 4096): a dense world that
+// size already spends hundreds of megabytes on grids that are mostly empty
+static constexpr unsigned long long AUTO_TILED_MIN_CELLS = 4096ULL * 4096ULL;
+
+bool parseOptions(int argc, char* argv[], SimulationOptions& options) {
+    bool seedGiven = false;
+    bool storageGiven = false;
+    for (int i = 1; i < argc; ++i) {
+        const std::string arg = argv[i];
+        if (arg == "--headless") {
+            options.headless = true;
+        }
+        else if (arg == "--ticks") {
+            if (!readUnsigned(argc, argv, i, options.maxTicks)) return false;
+        }
+        else if (arg == "--report-every") {
+            if (!readUnsigned(argc, argv, i, options.reportEvery)) return false;
+        }
+        else if (arg == "--grid-size") {
+            if (!readGridSize(argc, argv, i, options.gridWidth, options.gridHeight)) return false;
+        }
+        else if (arg == "--decay") {
+            const std::string mode = (i + 1 < argc) ? argv[++i] : "";
+            if (mode == "eager") options.decayMode = PheromoneDecayMode::Eager;
+            else if (mode == "lazy") options.decayMode = PheromoneDecayMode::Lazy;
+            else {
+                std::cerr << "Error: --decay expects 'eager' or 'lazy'.\n";
+                return false;
+            }
+        }
+        else if (arg == "--world-storage") {
+            const std::string mode = (i + 1 < argc) ? argv[++i] : "";
+            if (mode == "dense") options.worldStorage = WorldStorage::Dense;
+            else if (mode == "tiled") options.worldStorage = WorldStorage::Tiled;
+            else if (mode != "auto") {
+                std::cerr << "Error: --world-storage expects 'dense', 'tiled' or 'auto'.\n";
+                return false;
+            }
+            storageGiven = (mode != "auto");
+        }
+        else if (arg == "--pheromone-layout") {
+            const std::string layout = (i + 1 < argc) ? argv[++i] : "";
+            if (layout == "separate") options.pheromoneLayout = PheromoneLayout::Separate;
+            else if (layout == "interleaved") options.pheromoneLayout = PheromoneLayout::Interleaved;
+            else {
+                std::cerr << "Error: --pheromone-layout expects 'separate' or 'interleaved'.\n";
+                return false;
+            }
+        }
+        else if (arg == "--threads") {
+            unsigned long long threads = 0;
+            if (!readUnsigned(argc, argv, i, threads)) return false;
+            options.threads = static_cast<unsigned>(threads);
+        }
+        else if (arg == "--seed") {
+            unsigned long long seed = 0;
+            if (!readUnsigned(argc, argv, i, seed)) return false;
+            options.seed = seed;
+            seedGiven = true;
+        }
+        else if (arg == "--profile-log") {
+            if (i + 1 >= argc) {
+                std::cerr << "Error: --profile-log expects a file name.\n";
+                return false;
+            }
+            options.profileLog = argv[++i];
+        }
+        else if (arg == "--trace") {
+            if (i + 1 >= argc) {
+                std::cerr << "Error: --trace expects a file name.\n";
+                return false;
+            }
+            options.traceFile = argv[++i];
+        }
+        else if (arg == "--perf-counters") {
+            options.perfCounters = true;
+        }
+        else if (arg == "--help" || arg == "-h") {
+            options.showHelp = true;
+        }
+        else {
+            std::cerr << "Error: unknown option '" << arg << "'.\n";
+            return false;
+        }
+    }
+
+    // The interleaved grid is one dense buffer of half floats, so it has neither chunks nor a scale factor
+    if (options.pheromoneLayout == PheromoneLayout::Interleaved) {
+        if (options.decayMode == PheromoneDecayMode::Lazy) {
+            std::cerr << "Error: --pheromone-layout interleaved only supports --decay eager.\n";
+            return false;
+        }
+        if (storageGiven && options.worldStorage == WorldStorage::Tiled) {
+            std::cerr << "Error: --pheromone-layout interleaved needs --world-storage dense.\n";
+            return false;
+        }
+        // Auto would have picked tiled for a world this big; a dense one has to be asked for explicitly
+        const unsigned long long cells = static_cast<unsigned long long>(options.gridWidth) * options.gridHeight;
+        if (!storageGiven && cells > AUTO_TILED_MIN_CELLS) {
+            const unsigned long long gridBytes = (options.gridWidth + 2ULL) * (options.gridHeight + 2ULL) * sizeof(InterleavedPheromones::Cell);
+            std::cerr << "Error: --pheromone-layout interleaved needs a dense " << options.gridWidth << "x" << options.gridHeight
+                << " grid (" << (gridBytes >> 20) << " MiB); above 4096x4096 cells pass --world-storage dense to accept that.\n";
+            return false;
+        }
+        options.worldStorage = WorldStorage::Dense;
+        storageGiven = true;
+    }
+
+    if (!storageGiven) {
+        const unsigned long long cells = static_cast<unsigned long long>(options.gridWidth) * options.gridHeight;
+        options.worldStorage = cells > AUTO_TILED_MIN_CELLS ? WorldStorage::Tiled : WorldStorage::Dense;
+    }
+
+    // Auto never gets here (it switches to tiled long before), but an explicit dense world this big would
+    // overflow the 32-bit live-cell indices of the separate layout
+    const unsigned long long paddedCells = (options.gridWidth + 2ULL) * (options.gridHeight + 2ULL);
+    if (options.pheromoneLayout == PheromoneLayout::Separate && options.worldStorage == WorldStorage::Dense
+        && paddedCells > PheromoneField::MAX_DENSE_PADDED_CELLS) {
+        std::cerr << "Error: a " << options.gridWidth << "x" << options.gridHeight
+            << " world is too large for --world-storage dense; use tiled or auto.\n";
+        return false;
+    }
+
+    // Without --seed the run is still reproducible: the front ends print the seed that was picked
+    if (!seedGiven) {
+        std::random_device rd;
+        options.seed = (static_cast<std::uint64_t>(rd()) << 32) ^ rd();
+    }
+    return true;
+}
+
+void printUsage(const char* programName) {
+    std::cout << "Usage: " << programName << " [options]\n"
+        << "  --headless          Run the simulation without a window as fast as possible\n"
+        << "  --ticks N           Number of ticks to run in headless mode (default 10000, 0 = unlimited)\n"
+        << "  --report-every N    Print headless progress every N ticks (default 1000, 0 = off)\n"
+        << "  --grid-size N|WxH   World size in cells (default " << Environment::DEFAULT_GRID_SIZE << ")\n"
+        << "  --decay eager|lazy  Pheromone decay: sweep every cell each tick, or a per-colony scale factor (default eager)\n"
+        << "  --world-storage M   dense, tiled (64x64 chunks allocated where something happens) or auto\n"
+        << "                      (default auto: tiled above 4096x4096 cells)\n"
+        << "  --pheromone-layout  separate (float grids per colony) or interleaved (one shared grid of half-float\n"
+        << "                      levels for all colonies; eager decay and dense storage only, so above 4096x4096\n"
+        << "                      cells it also needs --world-storage dense) (default separate)\n"
+        << "  --threads N         Update ants on N threads (default 1, 0 = all cores)\n"
+        << "  --seed N            Random seed; the same seed and options reproduce a run exactly (default random)\n"
+        << "  --profile-log FILE  Append per-phase min/mean/p99 timings to FILE (CSV) every few seconds\n"
+        << "  --trace FILE        Record a timeline of every tick and frame phase to FILE (open in ui.perfetto.dev)\n"
+        << "  --perf-counters     Headless: report cycles, instructions, cache and branch misses per phase (Linux)\n"
+        << "  --help              Show this message\n";
+}
@@ -0,0 +1,47 @@
+// AntSimulation - An SFML simulation of an ant colony.
+// Copyright (C) 2025 Logan Herrera <jherre36@live.nmhu.edu>
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#ifndef OPTIONS_HPP
+#define OPTIONS_HPP
+
+#include "Colony.hpp"
+#include "Environment.hpp"
+#include <cstdint>
+#include <string>
+
+// Command line options shared by the windowed and headless front ends
+struct SimulationOptions {
+    bool headless = false;                  // --headless: run without a window, texture or font
+    unsigned long long maxTicks = 10000;    // --ticks N: headless run length (0 = run until killed)
+    unsigned long long reportEvery = 1000;  // --report-every N: headless progress line interval (0 = off)
+    int gridWidth = Environment::DEFAULT_GRID_SIZE;  // --grid-size N or WxH: world size in cells
+    int gridHeight = Environment::DEFAULT_GRID_SIZE;
+    PheromoneDecayMode decayMode = PheromoneDecayMode::Eager; // --decay eager|lazy
+    WorldStorage worldStorage = WorldStorage::Dense; // --world-storage dense|tiled|auto (auto is resolved from the grid size)
+    PheromoneLayout pheromoneLayout = PheromoneLayout::Separate; // --pheromone-layout separate|interleaved
+    unsigned threads = 1;                   // --threads N: worker threads for ant updates (0 = all cores); results do not depend on N
+    std::uint64_t seed = 0;                 // --seed N: reproduces a run exactly (a random seed is picked when not given)
+    std::string profileLog;                 // --profile-log FILE: periodic per-phase timing export (empty = off)
+    std::string traceFile;                  // --trace FILE: Chrome trace-event timeline of the run (empty = off)
+    bool perfCounters = false;              // --perf-counters: read hardware counters in every timed phase (Linux)
+    bool showHelp = false;                  // --help
+};
+
+// Parses argv into options. Returns false (after printing the problem) on an unknown or malformed argument.
+bool parseOptions(int argc, char* argv[], SimulationOptions& options);
+void printUsage(const char* programName);
+
+#endif // OPTIONS_HPP
@@ -0,0 +1,164 @@
+// AntSimulation - An SFML simulation of an ant colony.
+// Copyright (C) 2025 Logan Herrera <jherre36@live.nmhu.edu>
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+
+#include "PerfCounters.hpp"
+#include <atomic>
+#include <memory>
+
+#ifdef __linux__
+#include <cerrno>
+#include <cstring>
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace {
+std::atomic<bool> g_perfEnabled{ false };
+
+#ifdef __linux__
+struct EventConfig {
+    std::uint32_t type;
+    std::uint64_t config;
+};
+
+EventConfig eventConfig(PerfEvent event) {
+    switch (event) {
+    case PERF_CYCLES:       return { PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES };
+    case PERF_INSTRUCTIONS: return { PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS };
+    case PERF_L1D_READ_MISSES:
+        return { PERF_TYPE_HW_CACHE, PERF_COUNT_HW_CACHE_L1D | (PERF_COUNT_HW_CACHE_OP_READ << 8) | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16) };
+    case PERF_LLC_MISSES:   return { PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES };
+    case PERF_BRANCH_MISSES: return { PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES };
+    default:                return { PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES };
+    }
+}
+
+// Counts the calling thread in user space only, on any CPU (allowed with the default perf_event_paranoid of 2)
+int openEvent(PerfEvent event, int groupFd) {
+    perf_event_attr attr;
+    std::memset(&attr, 0, sizeof(attr));
+    attr.size = sizeof(attr);
+    const EventConfig config = eventConfig(event);
+    attr.type = config.type;
+    attr.config = config.config;
+    attr.disabled = groupFd == -1 ? 1 : 0; // The leader starts the whole group
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+    attr.read_format = PERF_FORMAT_GROUP | PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+    return static_cast<int>(syscall(__NR_perf_event_open, &attr, 0, -1, groupFd, 0));
+}
+#endif
+}
+
+PerfCounters::PerfCounters()
+    : m_available(false),
+    m_leaderFd(-1),
+    m_openCount(0)
+{
+    for (int e = 0; e < PERF_EVENT_COUNT; ++e) {
+        m_fd[e] = -1;
+        m_slot[e] = -1;
+    }
+#ifdef __linux__
+    // Cycles lead the group; without them nothing else is worth reading
+    m_leaderFd = openEvent(PERF_CYCLES, -1);
+    if (m_leaderFd < 0) {
+        m_reason = std::string("perf_event_open(cycles) failed: ") + std::strerror(errno)
+            + (errno == EACCES || errno == EPERM ? " (check /proc/sys/kernel/perf_event_paranoid)" : "");
+        return;
+    }
+    m_fd[PERF_CYCLES] = m_leaderFd;
+    m_slot[PERF_CYCLES] = m_openCount++;
+
+    for (int e = PERF_CYCLES + 1; e < PERF_EVENT_COUNT; ++e) {
+        const int fd = openEvent(static_cast<PerfEvent>(e), m_leaderFd);
+        if (fd < 0) {
+            m_reason += std::string(m_reason.empty() ? "" : "; ") + eventName(static_cast<PerfEvent>(e)) + " unsupported";
+            continue;
+        }
+        m_fd[e] = fd;
+        m_slot[e] = m_openCount++;
+    }
+
+    ioctl(m_leaderFd, PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+    ioctl(m_leaderFd, PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+    m_available = true;
+#else
+    m_reason = "hardware counters need Linux perf_event_open";
+#endif
+}
+
+PerfCounters::~PerfCounters() {
+#ifdef __linux__
+    for (int e = 0; e < PERF_EVENT_COUNT; ++e) {
+        if (m_fd[e] >= 0) {
+            close(m_fd[e]);
+        }
+    }
+#endif
+}
+
+bool PerfCounters::read(PerfSample& out) const {
+    if (!m_available) {
+        return false;
+    }
+#ifdef __linux__
+    // Group read layout: nr, time_enabled, time_running, then one value per open event in opening order
+    std::uint64_t buffer[3 + PERF_EVENT_COUNT];
+    const ssize_t expected = static_cast<ssize_t>((3 + m_openCount) * sizeof(std::uint64_t));
+    if (::read(m_leaderFd, buffer, sizeof(buffer)) < expected) {
+        return false;
+    }
+    const std::uint64_t enabled = buffer[1];
+    const std::uint64_t running = buffer[2];
+    // If the PMU was shared with other groups, extrapolate to the full enabled time
+    const double scale = (running > 0 && running < enabled) ? static_cast<double>(enabled) / running : 1.0;
+    for (int e = 0; e < PERF_EVENT_COUNT; ++e) {
+        out.value[e] = m_slot[e] >= 0 ? static_cast<std::uint64_t>(buffer[3 + m_slot[e]] * scale) : 0;
+    }
+    return true;
+#else
+    (void)out;
+    return false;
+#endif
+}
+
+const char* PerfCounters::eventName(PerfEvent event) {
+    switch (event) {
+    case PERF_CYCLES:          return "cycles";
+    case PERF_INSTRUCTIONS:    return "instructions";
+    case PERF_L1D_READ_MISSES: return "l1d_misses";
+    case PERF_LLC_MISSES:      return "llc_misses";
+    case PERF_BRANCH_MISSES:   return "branch_misses";
+    default:                   return "unknown";
+    }
+}
+
+void PerfCounters::setEnabled(bool enabled) {
+    g_perfEnabled.store(enabled, std::memory_order_relaxed);
+}
+
+bool PerfCounters::enabled() {
+    return g_perfEnabled.load(std::memory_order_relaxed);
+}
+
+PerfCounters& PerfCounters::forThisThread() {
+    thread_local std::unique_ptr<PerfCounters> counters(new PerfCounters());
+    return *counters;
+}
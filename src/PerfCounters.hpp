@@ -0,0 +1,86 @@
+// AntSimulation - An SFML simulation of an ant colony.
+// Copyright (C) 2025 Logan Herrera <jherre36@live.nmhu.edu>
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+
+#ifndef PERF_COUNTERS_HPP
+#define PERF_COUNTERS_HPP
+
+#include <cstdint>
+#include <string>
+
+// Hardware performance counters for the calling thread, read through Linux perf_event_open.
+// Opt-in with --perf-counters: every ANTSIM_PROFILE_SCOPE then also adds the counter deltas of its thread
+// to its section, and the headless run prints per-tick and per-ant figures at the end (ant_bench reads
+// them around each benchmark). Each thread gets its own counter group the first time it runs a scope.
+// Where counters cannot be opened (not Linux, perf_event_paranoid too strict, no PMU in a VM) everything
+// falls back to wall time only; reason() says why. A single unsupported event leaves the others working.
+enum PerfEvent {
+    PERF_CYCLES = 0,
+    PERF_INSTRUCTIONS,
+    PERF_L1D_READ_MISSES,
+    PERF_LLC_MISSES,
+    PERF_BRANCH_MISSES,
+    PERF_EVENT_COUNT
+};
+
+// Counter values (totals or deltas); an event that could not be opened reads 0
+struct PerfSample {
+    std::uint64_t value[PERF_EVENT_COUNT] = {};
+
+    PerfSample operator-(const PerfSample& earlier) const {
+        PerfSample delta;
+        for (int e = 0; e < PERF_EVENT_COUNT; ++e) {
+            delta.value[e] = value[e] >= earlier.value[e] ? value[e] - earlier.value[e] : 0;
+        }
+        return delta;
+    }
+};
+
+class PerfCounters {
+public:
+    // Opens and starts the counter group for the calling thread
+    PerfCounters();
+    ~PerfCounters();
+
+    PerfCounters(const PerfCounters&) = delete;
+    PerfCounters& operator=(const PerfCounters&) = delete;
+
+    bool available() const { return m_available; }
+    bool has(PerfEvent event) const { return m_slot[event] >= 0; }
+    // Why counters (or some events) are missing; empty when all of them work
+    const std::string& reason() const { return m_reason; }
+
+    // Current totals since the group was opened (scaled if the kernel had to multiplex). False if unavailable.
+    bool read(PerfSample& out) const;
+
+    static const char* eventName(PerfEvent event); // Short name for reports, e.g. "cycles"
+
+    // --- Process-wide switch used by the profile scopes ---
+    static void setEnabled(bool enabled);
+    static bool enabled();
+    // The calling thread's counters, opened on first use (check available())
+    static PerfCounters& forThisThread();
+
+private:
+    bool m_available;
+    std::string m_reason;
+    int m_leaderFd;
+    int m_fd[PERF_EVENT_COUNT];
+    int m_slot[PERF_EVENT_COUNT]; // Position of each event in the group read, -1 if it could not be opened
+    int m_openCount;
+};
+
+#endif // PERF_COUNTERS_HPP
@@ -0,0 +1,320 @@
+// AntSimulation - An SFML simulation of an ant colony.
+// Copyright (C) 2025 Logan Herrera <jherre36@live.nmhu.edu>
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#include "PheromoneField.hpp"
+#include "PheromoneKernels.hpp"
+#include <algorithm>
+#include <cmath>
+
+void PheromoneChunk::clear() {
+    std::fill(food, food + TileShape::CELLS, 0.0f);
+    std::fill(home, home + TileShape::CELLS, 0.0f);
+    std::fill(listed, listed + TileShape::CELLS / 64, 0);
+    liveCells = 0;
+}
+
+bool PheromoneChunk::empty() const {
+    for (int i = 0; i < TileShape::CELLS; ++i) {
+        if (food[i] != 0.0f || home[i] != 0.0f) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Constructor (only the chosen storage is allocated)
+PheromoneField::PheromoneField(int width, int height, PheromoneDecayMode mode, WorldStorage storage,
+    InterleavedPheromones* shared, int colony)
+    : m_width(width),
+    m_height(height),
+    m_mode(shared != nullptr ? PheromoneDecayMode::Eager : mode),
+    m_storage(shared != nullptr ? WorldStorage::Dense : storage),
+    m_neighborOffsets{},
+    m_shared(shared),
+    m_foodChannel(InterleavedPheromones::foodChannel(colony)),
+    m_homeChannel(InterleavedPheromones::homeChannel(colony)),
+    m_sharedDecaySteps(0),
+    m_scale(1.0),
+    m_readScale(1.0f),
+    m_writeScale(1.0f),
+    m_lazyTick(0)
+{
+    if (m_storage == WorldStorage::Dense) {
+        const int paddedWidth = width + 2;
+        if (shared == nullptr) {
+            // The border row/column on each side is never written, so it stays at zero through every decay
+            m_food = Grid<float>(paddedWidth, height + 2, 0.0f);
+            m_home = Grid<float>(paddedWidth, height + 2, 0.0f);
+            m_active = ActiveCellSet(m_food.size());
+        }
+        for (int d = 0; d < Directions::COUNT; ++d) {
+            m_neighborOffsets[d] = static_cast<std::ptrdiff_t>(Directions::DY[d]) * paddedWidth + Directions::DX[d];
+        }
+    }
+    else {
+        m_tiles = TiledGrid<PheromoneChunk>(width, height);
+    }
+    if (m_mode == PheromoneDecayMode::Lazy) {
+        m_expiry.resize(LAZY_EXPIRY_SLOTS);
+    }
+}
+
+// With a scale of 1 (Eager mode) this is the plain add-and-clamp
+bool PheromoneField::add(float& stored, float amount) const {
+    float level = toLevel(stored) + amount;
+    if (level > MAX_LEVEL) {
+        level = MAX_LEVEL;
+    }
+    if (level < 0.0f) {
+        level = 0.0f;
+    }
+    stored = level * m_writeScale;
+    return level > 0.0f;
+}
+
+// Same add-and-clamp on a half float (rounded to the nearest half)
+void PheromoneField::addHalf(std::uint16_t& stored, float amount) {
+    float level = PheromoneKernels::halfToFloat(stored) + amount;
+    if (level > MAX_LEVEL) {
+        level = MAX_LEVEL;
+    }
+    if (level < 0.0f) {
+        level = 0.0f;
+    }
+    stored = PheromoneKernels::floatToHalf(level);
+}
+
+void PheromoneField::addDense(bool foodLayer, size_t cell, float amount) {
+    if (m_shared != nullptr) {
+        addHalf(m_shared->data()[cell].channel[foodLayer ? m_foodChannel : m_homeChannel], amount);
+        return;
+    }
+    if (add(foodLayer ? m_food[cell] : m_home[cell], amount) && m_active.insert(static_cast<uint32_t>(cell))
+        && m_mode == PheromoneDecayMode::Lazy) {
+        scheduleExpiry(cell, m_food[cell], m_home[cell]);
+    }
+}
+
+void PheromoneField::addTiled(bool foodLayer, int x, int y, float amount) {
+    PheromoneChunk& chunk = m_tiles.obtain(x, y);
+    const int cell = TileShape::cellInChunk(x, y);
+    const bool live = add(foodLayer ? chunk.food[cell] : chunk.home[cell], amount);
+    if (m_mode != PheromoneDecayMode::Lazy) {
+        return; // Eager decay hands empty chunks back on its next sweep
+    }
+    std::uint64_t& listedWord = chunk.listed[cell >> 6];
+    const std::uint64_t mask = std::uint64_t(1) << (cell & 63);
+    if (live && !(listedWord & mask)) {
+        listedWord |= mask;
+        chunk.liveCells++;
+        scheduleExpiry(tileEntry(m_tiles.chunkIndex(x, y), cell), chunk.food[cell], chunk.home[cell]);
+    }
+    if (chunk.liveCells == 0) {
+        m_tiles.release(x, y); // Obtained for an add that left nothing behind
+    }
+}
+
+void PheromoneField::addFood(int x, int y, float amount) {
+    if (!inBounds(x, y)) {
+        return;
+    }
+    if (m_storage == WorldStorage::Dense) {
+        addDense(true, paddedIndex(x, y), amount);
+        return;
+    }
+    addTiled(true, x, y, amount);
+}
+
+void PheromoneField::addHome(int x, int y, float amount) {
+    if (!inBounds(x, y)) {
+        return;
+    }
+    if (m_storage == WorldStorage::Dense) {
+        addDense(false, paddedIndex(x, y), amount);
+        return;
+    }
+    addTiled(false, x, y, amount);
+}
+
+size_t PheromoneField::activeCellCount() const {
+    if (m_storage == WorldStorage::Dense && m_shared == nullptr) {
+        return m_active.size();
+    }
+    size_t count = 0;
+    forEachActiveCell([&](std::uint64_t, float, float) { count++; });
+    return count;
+}
+
+size_t PheromoneField::memoryBytes() const {
+    if (m_shared != nullptr) {
+        return 0;
+    }
+    size_t expiryBytes = 0;
+    for (const std::vector<std::uint64_t>& bucket : m_expiry) {
+        expiryBytes += bucket.size() * sizeof(std::uint64_t);
+    }
+    if (m_storage == WorldStorage::Dense) {
+        return (m_food.size() + m_home.size()) * sizeof(float) + m_active.memoryBytes() + expiryBytes;
+    }
+    return m_tiles.memoryBytes() + expiryBytes;
+}
+
+void PheromoneField::decay() {
+    if (m_shared != nullptr) {
+        m_shared->decayStep(m_sharedDecaySteps++, DECAY_RATE, ZERO_THRESHOLD);
+        return;
+    }
+    if (m_mode == PheromoneDecayMode::Lazy) {
+        // Decaying every cell by the same factor is the same as shrinking the factor they are all read through
+        m_scale *= DECAY_RATE;
+        if (m_scale < LAZY_RENORMALIZE_SCALE) {
+            renormalize();
+        }
+        m_readScale = static_cast<float>(m_scale);
+        m_writeScale = static_cast<float>(1.0 / m_scale);
+        m_lazyTick++;
+        expireFaded();
+        return;
+    }
+    if (m_storage == WorldStorage::Tiled) {
+        decayTiled();
+        return;
+    }
+    decayEager();
+}
+
+// Every chunk is a small dense grid: sweep it with the vectorized kernel and hand it back to the pool
+// once nothing is left in it
+void PheromoneField::decayTiled() {
+    m_tiles.releaseIf([](PheromoneChunk& chunk) {
+        PheromoneKernels::decay(chunk.food, chunk.home, TileShape::CELLS, DECAY_RATE, ZERO_THRESHOLD);
+        return chunk.empty();
+    });
+}
+
+void PheromoneField::decayEager() {
+    float* food = m_food.data();
+    float* home = m_home.data();
+
+    if (m_active.size() > m_food.size() / DENSE_SWEEP_DIVISOR) {
+        // Mostly live: one fused vectorized sweep over both contiguous buffers is cheaper than chasing indices
+        PheromoneKernels::decay(food, home, m_food.size(), DECAY_RATE, ZERO_THRESHOLD);
+        m_active.removeIf([&](uint32_t cell) { return food[cell] == 0.0f && home[cell] == 0.0f; });
+        return;
+    }
+
+    // Sparse: only touch live cells (same per-cell rule as the kernel), dropping them once both levels hit zero
+    m_active.removeIf([&](uint32_t cell) {
+        float& f = food[cell];
+        float& h = home[cell];
+        if (f > ZERO_THRESHOLD) {
+            f *= DECAY_RATE;
+            if (f < ZERO_THRESHOLD) f = 0.0f;
+        }
+        else {
+            f = 0.0f;
+        }
+        if (h > ZERO_THRESHOLD) {
+            h *= DECAY_RATE;
+            if (h < ZERO_THRESHOLD) h = 0.0f;
+        }
+        else {
+            h = 0.0f;
+        }
+        return f == 0.0f && h == 0.0f;
+    });
+}
+
+// Lists a live cell under the tick its stronger layer should fade below ZERO_THRESHOLD. The estimate is
+// taken one tick early to absorb rounding; expireFaded checks again and lists the cell anew if it survives.
+void PheromoneField::scheduleExpiry(std::uint64_t entry, float storedFood, float storedHome) {
+    const float level = std::max(toLevel(storedFood), toLevel(storedHome));
+    int ticks = 1;
+    if (level > 0.0f) {
+        const double ticksLeft = std::log(ZERO_THRESHOLD / level) / std::log(static_cast<double>(DECAY_RATE));
+        ticks = std::clamp(static_cast<int>(ticksLeft) - 1, 1, LAZY_EXPIRY_SLOTS - 1);
+    }
+    m_expiry[(m_lazyTick + ticks) % LAZY_EXPIRY_SLOTS].push_back(entry);
+}
+
+// Drops the cells due this tick that now read as zero (handing a chunk back to the pool once its last cell
+// is gone) and relists the ones that were refreshed since. Each cell is looked at about once per deposit,
+// so decay stays O(1) amortized. A relisted cell never lands in this bucket again: it is due at least one
+// tick and at most a lap ahead.
+void PheromoneField::expireFaded() {
+    std::vector<std::uint64_t>& due = m_expiry[m_lazyTick % LAZY_EXPIRY_SLOTS];
+    for (std::uint64_t entry : due) {
+        float* food;
+        float* home;
+        PheromoneChunk* chunk = nullptr;
+        int cell = 0;
+        if (m_storage == WorldStorage::Dense) {
+            food = &m_food[entry];
+            home = &m_home[entry];
+        }
+        else {
+            chunk = &m_tiles.chunkAt(static_cast<std::uint32_t>(entry >> TILE_ENTRY_SHIFT));
+            cell = static_cast<int>(entry & (TileShape::CELLS - 1));
+            food = &chunk->food[cell];
+            home = &chunk->home[cell];
+        }
+        if (toLevel(*food) != 0.0f || toLevel(*home) != 0.0f) {
+            scheduleExpiry(entry, *food, *home);
+            continue;
+        }
+        *food = 0.0f;
+        *home = 0.0f;
+        if (chunk == nullptr) {
+            m_active.erase(static_cast<uint32_t>(entry));
+            continue;
+        }
+        chunk->listed[cell >> 6] &= ~(std::uint64_t(1) << (cell & 63));
+        if (--chunk->liveCells == 0) {
+            const std::uint32_t chunkIndex = static_cast<std::uint32_t>(entry >> TILE_ENTRY_SHIFT);
+            m_tiles.release(m_tiles.chunkOriginX(chunkIndex), m_tiles.chunkOriginY(chunkIndex));
+        }
+    }
+    due.clear();
+}
+
+// Folds the lazy scale factor back into every live cell (snapping faded cells to zero) and resets it to 1.
+// Runs roughly every 3,400 ticks at the default decay rate. Dropping faded cells and releasing chunks is
+// left to expireFaded, which runs right after.
+void PheromoneField::renormalize() {
+    const float scale = static_cast<float>(m_scale);
+    if (m_storage == WorldStorage::Tiled) {
+        for (std::uint32_t chunkIndex : m_tiles.allocatedChunks()) {
+            PheromoneChunk& chunk = m_tiles.chunkAt(chunkIndex);
+            for (int i = 0; i < TileShape::CELLS; ++i) {
+                const float foodLevel = chunk.food[i] * scale;
+                const float homeLevel = chunk.home[i] * scale;
+                chunk.food[i] = foodLevel < ZERO_THRESHOLD ? 0.0f : foodLevel;
+                chunk.home[i] = homeLevel < ZERO_THRESHOLD ? 0.0f : homeLevel;
+            }
+        }
+        m_scale = 1.0;
+        return;
+    }
+    float* food = m_food.data();
+    float* home = m_home.data();
+    m_active.forEach([&](uint32_t cell) {
+        const float foodLevel = food[cell] * scale;
+        const float homeLevel = home[cell] * scale;
+        food[cell] = foodLevel < ZERO_THRESHOLD ? 0.0f : foodLevel;
+        home[cell] = homeLevel < ZERO_THRESHOLD ? 0.0f : homeLevel;
+    });
+    m_scale = 1.0;
+}
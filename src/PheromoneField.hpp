@@ -0,0 +1,267 @@
+// AntSimulation - An SFML simulation of an ant colony.
+// Copyright (C) 2025 Logan Herrera <jherre36@live.nmhu.edu>
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#ifndef PHEROMONE_FIELD_HPP
+#define PHEROMONE_FIELD_HPP
+
+#include "ActiveCellSet.hpp"
+#include "Directions.hpp"
+#include "Grid.hpp"
+#include "InterleavedPheromones.hpp"
+#include "PheromoneKernels.hpp"
+#include "TiledGrid.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// How a colony fades its pheromone trails every tick
+enum class PheromoneDecayMode {
+    Eager, // Multiply every live cell of both grids each tick
+    Lazy   // Store cells in "undecayed" units and shrink one per-colony scale factor instead (O(1) per tick)
+};
+
+// One tile of both pheromone layers (Tiled storage), laid out as two contiguous planes so the decay
+// kernels sweep a chunk exactly like they sweep a dense grid
+struct PheromoneChunk {
+    alignas(64) float food[TileShape::CELLS];
+    alignas(64) float home[TileShape::CELLS];
+    // Lazy decay only: the cells listed for expiry (one bit each) and how many there are, so the chunk can
+    // go back to the pool the moment its last cell fades
+    std::uint64_t listed[TileShape::CELLS / 64];
+    unsigned int liveCells;
+
+    PheromoneChunk() { clear(); }
+    void clear();
+    bool empty() const; // True once every cell of both layers is zero
+};
+
+// A colony's "to food" and "to home" pheromone grids plus the bookkeeping that keeps them cheap:
+// the lazy decay scale factor and the set of cells that currently hold any pheromone.
+// Decay, rendering and statistics only visit live cells, so empty space costs nothing.
+// Dense storage keeps two full grids and a live-cell set; Tiled storage keeps 64x64 chunks that exist
+// only where pheromone was laid and are released once they decay to nothing (in Lazy mode, on the tick their
+// last live cell fades). Both give identical levels.
+// The dense grids carry a one-cell border that always reads as empty, so the 8 neighbours of any
+// in-bounds cell are plain loads at fixed index offsets (see gatherFood).
+// With the Interleaved layout the field owns no grid at all: it reads and writes its colony's two
+// channels of a shared InterleavedPheromones grid (half floats, always eager decay, Dense storage). The
+// shared grid is swept whole every tick anyway, so there is no live-cell set to maintain either.
+class PheromoneField {
+public:
+    static constexpr float DECAY_RATE = 0.98f;        // How quickly pheromones fade over time
+    static constexpr float MAX_LEVEL = 500.0f;        // A cap for pheromone levels
+    static constexpr float ZERO_THRESHOLD = 0.001f;   // Levels that decay below this snap to zero
+    // Lazy mode folds the scale factor back into the grids before it gets anywhere near float underflow
+    static constexpr double LAZY_RENORMALIZE_SCALE = 1e-30;
+    // Dense storage tracks live cells by 32-bit padded index, so (width + 2) * (height + 2) may not exceed this
+    static constexpr std::uint64_t MAX_DENSE_PADDED_CELLS = std::uint64_t(1) << 32;
+    // Lazy mode rechecks each live cell when it is due to fade; this many ticks covers the longest trail
+    // (MAX_LEVEL fading to ZERO_THRESHOLD takes about 650 ticks)
+    static constexpr int LAZY_EXPIRY_SLOTS = 1024;
+    // Above this fraction of live cells a full vectorized sweep beats walking the cell list
+    static constexpr size_t DENSE_SWEEP_DIVISOR = 4;
+
+    // shared selects the Interleaved layout: colony picks the channels, mode and storage are ignored
+    PheromoneField(int width, int height, PheromoneDecayMode mode, WorldStorage storage = WorldStorage::Dense,
+        InterleavedPheromones* shared = nullptr, int colony = 0);
+
+    int width() const { return m_width; }
+    int height() const { return m_height; }
+    PheromoneDecayMode decayMode() const { return m_mode; }
+    WorldStorage storage() const { return m_storage; }
+    PheromoneLayout layout() const { return m_shared != nullptr ? PheromoneLayout::Interleaved : PheromoneLayout::Separate; }
+
+    bool inBounds(int x, int y) const {
+        return x >= 0 && x < m_width && y >= 0 && y < m_height;
+    }
+
+    // Levels are in real (decayed) units regardless of decay mode; out of bounds reads return 0
+    float foodLevel(int x, int y) const {
+        if (!inBounds(x, y)) {
+            return 0.0f;
+        }
+        if (m_storage == WorldStorage::Dense) {
+            return foodAt(paddedIndex(x, y));
+        }
+        const PheromoneChunk* chunk = m_tiles.find(x, y);
+        return chunk != nullptr ? toLevel(chunk->food[TileShape::cellInChunk(x, y)]) : 0.0f;
+    }
+    float homeLevel(int x, int y) const {
+        if (!inBounds(x, y)) {
+            return 0.0f;
+        }
+        if (m_storage == WorldStorage::Dense) {
+            return homeAt(paddedIndex(x, y));
+        }
+        const PheromoneChunk* chunk = m_tiles.find(x, y);
+        return chunk != nullptr ? toLevel(chunk->home[TileShape::cellInChunk(x, y)]) : 0.0f;
+    }
+
+    // Levels of the 8 neighbours of (x, y) in direction order (Directions::DX/DY); neighbours outside the
+    // world read 0. (x, y) must be in bounds. Dense storage reads them without a single bounds check.
+    void gatherFood(int x, int y, float levels[Directions::COUNT]) const { gather(true, x, y, levels); }
+    void gatherHome(int x, int y, float levels[Directions::COUNT]) const { gather(false, x, y, levels); }
+
+    // Adds amount (real units) and clamps the resulting level to [0, MAX_LEVEL]; out of bounds is ignored
+    void addFood(int x, int y, float amount);
+    void addHome(int x, int y, float amount);
+
+    // Advance decay by one tick. With the Interleaved layout this requests the shared grid's next decay step,
+    // which sweeps every colony's channels once no matter how many colonies ask for it.
+    void decay();
+
+    // Calls visit(cell, homeLevel, foodLevel) for every cell holding a non-zero food or home level, with
+    // cell = y * width + x; both decay modes visit the same cells. Dense storage visits in the order cells
+    // became live, Tiled storage chunk by chunk, the Interleaved layout row by row (scanning the whole shared grid).
+    template <typename Visitor>
+    void forEachActiveCell(Visitor visit) const {
+        if (m_shared != nullptr) {
+            const InterleavedPheromones::Cell* row = m_shared->data() + paddedIndex(0, 0);
+            for (int y = 0; y < m_height; ++y, row += m_width + 2) {
+                for (int x = 0; x < m_width; ++x) {
+                    const std::uint16_t food = row[x].channel[m_foodChannel];
+                    const std::uint16_t home = row[x].channel[m_homeChannel];
+                    if (food != 0 || home != 0) {
+                        visit(static_cast<std::uint64_t>(y) * m_width + x,
+                            PheromoneKernels::halfToFloat(home), PheromoneKernels::halfToFloat(food));
+                    }
+                }
+            }
+            return;
+        }
+        if (m_storage == WorldStorage::Dense) {
+            const uint32_t paddedWidth = static_cast<uint32_t>(m_width + 2);
+            m_active.forEach([&](uint32_t cell) {
+                const std::uint64_t x = cell % paddedWidth - 1;
+                const std::uint64_t y = cell / paddedWidth - 1;
+                visit(y * static_cast<std::uint64_t>(m_width) + x, homeAt(cell), foodAt(cell));
+            });
+            return;
+        }
+        for (std::uint32_t chunkIndex : m_tiles.allocatedChunks()) {
+            const PheromoneChunk& chunk = m_tiles.chunkAt(chunkIndex);
+            const int originX = m_tiles.chunkOriginX(chunkIndex);
+            const int originY = m_tiles.chunkOriginY(chunkIndex);
+            for (int i = 0; i < TileShape::CELLS; ++i) {
+                if (chunk.food[i] == 0.0f && chunk.home[i] == 0.0f) {
+                    continue;
+                }
+                const int x = originX + (i & (TileShape::SIZE - 1));
+                const int y = originY + (i >> TileShape::SHIFT);
+                visit(static_cast<std::uint64_t>(y) * m_width + x, toLevel(chunk.home[i]), toLevel(chunk.food[i]));
+            }
+        }
+    }
+    // Number of cells forEachActiveCell visits. O(1) for Dense storage; Tiled storage counts its chunks' cells
+    // and the Interleaved layout scans the shared grid.
+    size_t activeCellCount() const;
+    // Bytes held by the pheromone layers and their bookkeeping (none with the Interleaved layout; the shared
+    // grid is counted once by its owner)
+    size_t memoryBytes() const;
+
+private:
+    int m_width, m_height;
+    PheromoneDecayMode m_mode;
+    WorldStorage m_storage;
+
+    // Dense storage (empty when Tiled or Interleaved), (width + 2) x (height + 2) with an empty border; the
+    // live-cell set and every index into the grids use these padded positions
+    Grid<float> m_food; // "Food Trail" pheromones
+    Grid<float> m_home; // "Home trail" pheromones
+    ActiveCellSet m_active;
+    std::ptrdiff_t m_neighborOffsets[Directions::COUNT]; // Padded index step to each neighbour
+
+    // Tiled storage (empty when Dense)
+    TiledGrid<PheromoneChunk> m_tiles;
+
+    // Interleaved layout: the shared grid (same padded positions as m_food) and this colony's channels
+    InterleavedPheromones* m_shared;
+    int m_foodChannel, m_homeChannel;
+    unsigned long long m_sharedDecaySteps; // Decay steps this field has requested from the shared grid
+
+    // Lazy decay state: real level = stored value * m_scale. Always 1 in Eager mode.
+    double m_scale;
+    float m_readScale;  // m_scale as float, applied on every read
+    float m_writeScale; // 1 / m_scale, applied on every write
+    // Lazy mode: every live cell is listed once, under the tick it is expected to fade out (never later
+    // than it really does), so it leaves m_active or its chunk on the same tick eager decay drops it.
+    // Entries are padded indices in Dense storage and tileEntry() in Tiled storage.
+    std::vector<std::vector<std::uint64_t>> m_expiry; // LAZY_EXPIRY_SLOTS buckets indexed by tick
+    std::uint64_t m_lazyTick;
+
+    static constexpr int TILE_ENTRY_SHIFT = 2 * TileShape::SHIFT;
+    static std::uint64_t tileEntry(std::uint32_t chunk, int cell) {
+        return (static_cast<std::uint64_t>(chunk) << TILE_ENTRY_SHIFT) | static_cast<std::uint64_t>(cell);
+    }
+
+    // Converts a stored cell to a real level, snapping anything below the threshold to zero like the eager sweep does
+    float toLevel(float stored) const {
+        float level = stored * m_readScale;
+        return level < ZERO_THRESHOLD ? 0.0f : level;
+    }
+    // Real levels at a padded Dense index, from whichever layout is in use
+    float foodAt(size_t cell) const {
+        return m_shared != nullptr ? PheromoneKernels::halfToFloat(m_shared->data()[cell].channel[m_foodChannel]) : toLevel(m_food[cell]);
+    }
+    float homeAt(size_t cell) const {
+        return m_shared != nullptr ? PheromoneKernels::halfToFloat(m_shared->data()[cell].channel[m_homeChannel]) : toLevel(m_home[cell]);
+    }
+    size_t paddedIndex(int x, int y) const {
+        return static_cast<size_t>(y + 1) * static_cast<size_t>(m_width + 2) + static_cast<size_t>(x + 1);
+    }
+    void gather(bool foodLayer, int x, int y, float levels[Directions::COUNT]) const {
+        if (m_shared != nullptr) {
+            // Every colony's channels of a cell share its 16 bytes; this colony only looks at its own
+            const InterleavedPheromones::Cell* center = m_shared->data() + paddedIndex(x, y);
+            const int channel = foodLayer ? m_foodChannel : m_homeChannel;
+            for (int d = 0; d < Directions::COUNT; ++d) {
+                levels[d] = PheromoneKernels::halfToFloat(center[m_neighborOffsets[d]].channel[channel]);
+            }
+            return;
+        }
+        if (m_storage == WorldStorage::Dense) {
+            const float* center = (foodLayer ? m_food : m_home).data() + paddedIndex(x, y);
+            for (int d = 0; d < Directions::COUNT; ++d) {
+                levels[d] = toLevel(center[m_neighborOffsets[d]]);
+            }
+            return;
+        }
+        for (int d = 0; d < Directions::COUNT; ++d) {
+            const int neighborX = x + Directions::DX[d];
+            const int neighborY = y + Directions::DY[d];
+            const PheromoneChunk* chunk = inBounds(neighborX, neighborY) ? m_tiles.find(neighborX, neighborY) : nullptr;
+            if (chunk == nullptr) {
+                levels[d] = 0.0f;
+                continue;
+            }
+            const int cell = TileShape::cellInChunk(neighborX, neighborY);
+            levels[d] = toLevel(foodLayer ? chunk->food[cell] : chunk->home[cell]);
+        }
+    }
+    // Adds amount to a stored cell and clamps the level; returns true if the cell now holds pheromone
+    bool add(float& stored, float amount) const;
+    static void addHalf(std::uint16_t& stored, float amount);
+    // Dense and Interleaved: adds to one layer of a padded cell (tracking it as live in Dense storage)
+    void addDense(bool foodLayer, size_t cell, float amount);
+    void addTiled(bool foodLayer, int x, int y, float amount);
+    void decayEager();
+    void decayTiled();
+    void scheduleExpiry(std::uint64_t entry, float storedFood, float storedHome);
+    void expireFaded();
+    void renormalize();
+};
+
+#endif // PHEROMONE_FIELD_HPP
@@ -0,0 +1,284 @@
+// AntSimulation - An SFML simulation of an ant colony.
+// Copyright (C) 2025 Logan Herrera <jherre36@live.nmhu.edu>
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#include "PheromoneKernels.hpp"
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+#define ANTSIM_X86 1
+#include <immintrin.h>
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+#endif
+
+// GCC and Clang only emit AVX2 instructions inside functions that ask for them,
+// which keeps the rest of the binary runnable on CPUs without AVX2. MSVC needs no attribute.
+#if defined(ANTSIM_X86) && (defined(__GNUC__) || defined(__clang__))
+#define ANTSIM_TARGET_AVX2 __attribute__((target("avx2")))
+#define ANTSIM_TARGET_SSE2 __attribute__((target("sse2")))
+#else
+#define ANTSIM_TARGET_AVX2
+#define ANTSIM_TARGET_SSE2
+#endif
+
+// Reference implementation, kept in the original branchy form
+static void decayScalar(float* food, float* home, size_t begin, size_t end, float rate, float threshold) {
+    for (size_t i = begin; i < end; ++i) {
+        if (food[i] > threshold) {
+            food[i] *= rate;
+            if (food[i] < threshold) food[i] = 0.0f;
+        }
+        else {
+            food[i] = 0.0f;
+        }
+
+        if (home[i] > threshold) {
+            home[i] *= rate;
+            if (home[i] < threshold) home[i] = 0.0f;
+        }
+        else {
+            home[i] = 0.0f;
+        }
+    }
+}
+
+static void decayHalfScalar(std::uint16_t* levels, size_t begin, size_t end, float rate, float threshold) {
+    for (size_t i = begin; i < end; ++i) {
+        float level = levels[i] < 0x8000 ? PheromoneKernels::halfToFloat(levels[i]) : -1.0f;
+        if (level > threshold) {
+            level *= rate;
+            if (level < threshold) level = 0.0f;
+        }
+        else {
+            level = 0.0f;
+        }
+        levels[i] = PheromoneKernels::floatToHalf(level);
+    }
+}
+
+#ifdef ANTSIM_X86
+// keep = (v > threshold) && (v * rate >= threshold); result = keep ? v * rate : 0
+// NaN fails both ordered compares and ends up 0, same as the scalar else-branch.
+ANTSIM_TARGET_SSE2
+static inline __m128 decayLanesSSE(__m128 v, __m128 rate, __m128 threshold) {
+    const __m128 decayed = _mm_mul_ps(v, rate);
+    const __m128 keep = _mm_and_ps(_mm_cmpgt_ps(v, threshold), _mm_cmpge_ps(decayed, threshold));
+    return _mm_and_ps(decayed, keep);
+}
+
+ANTSIM_TARGET_SSE2
+static void decaySSE(float* food, float* home, size_t cellCount, float rate, float threshold) {
+    const __m128 rateV = _mm_set1_ps(rate);
+    const __m128 thresholdV = _mm_set1_ps(threshold);
+    size_t i = 0;
+    for (; i + 4 <= cellCount; i += 4) {
+        _mm_storeu_ps(food + i, decayLanesSSE(_mm_loadu_ps(food + i), rateV, thresholdV));
+        _mm_storeu_ps(home + i, decayLanesSSE(_mm_loadu_ps(home + i), rateV, thresholdV));
+    }
+    decayScalar(food, home, i, cellCount, rate, threshold);
+}
+
+ANTSIM_TARGET_AVX2
+static inline __m256 decayLanesAVX2(__m256 v, __m256 rate, __m256 threshold) {
+    const __m256 decayed = _mm256_mul_ps(v, rate);
+    const __m256 keep = _mm256_and_ps(_mm256_cmp_ps(v, threshold, _CMP_GT_OQ), _mm256_cmp_ps(decayed, threshold, _CMP_GE_OQ));
+    return _mm256_and_ps(decayed, keep);
+}
+
+ANTSIM_TARGET_AVX2
+static void decayAVX2(float* food, float* home, size_t cellCount, float rate, float threshold) {
+    const __m256 rateV = _mm256_set1_ps(rate);
+    const __m256 thresholdV = _mm256_set1_ps(threshold);
+    size_t i = 0;
+    for (; i + 8 <= cellCount; i += 8) {
+        _mm256_storeu_ps(food + i, decayLanesAVX2(_mm256_loadu_ps(food + i), rateV, thresholdV));
+        _mm256_storeu_ps(home + i, decayLanesAVX2(_mm256_loadu_ps(home + i), rateV, thresholdV));
+    }
+    decayScalar(food, home, i, cellCount, rate, threshold);
+}
+
+// Four halves widened to 32 bits: rebase to float, decay, and round back. A zero half decodes to 2^-15,
+// which fails the threshold test like a real 0 would, and dropped lanes are masked back to 0 after encoding.
+// Sign-bit halves are dropped explicitly, so kept lanes encode below 0x8000 and the signed pack in the
+// caller narrows them unchanged.
+ANTSIM_TARGET_SSE2
+static inline __m128i decayHalfLanesSSE(__m128i halves, __m128 rate, __m128 threshold) {
+    const __m128i rebase = _mm_set1_epi32(static_cast<int>(PheromoneKernels::HALF_EXPONENT_REBASE));
+    const __m128 v = _mm_castsi128_ps(_mm_add_epi32(_mm_slli_epi32(halves, 13), rebase));
+    const __m128 decayed = _mm_mul_ps(v, rate);
+    const __m128 positive = _mm_castsi128_ps(_mm_cmplt_epi32(halves, _mm_set1_epi32(0x8000)));
+    const __m128 keep = _mm_and_ps(positive, _mm_and_ps(_mm_cmpgt_ps(v, threshold), _mm_cmpge_ps(decayed, threshold)));
+    const __m128i rounded = _mm_add_epi32(_mm_sub_epi32(_mm_castps_si128(decayed), rebase), _mm_set1_epi32(0x1000));
+    return _mm_and_si128(_mm_srli_epi32(rounded, 13), _mm_castps_si128(keep));
+}
+
+ANTSIM_TARGET_SSE2
+static void decayHalfSSE(std::uint16_t* levels, size_t count, float rate, float threshold) {
+    const __m128 rateV = _mm_set1_ps(rate);
+    const __m128 thresholdV = _mm_set1_ps(threshold);
+    const __m128i zero = _mm_setzero_si128();
+    size_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        __m128i* lanes = reinterpret_cast<__m128i*>(levels + i);
+        const __m128i halves = _mm_loadu_si128(lanes);
+        const __m128i low = decayHalfLanesSSE(_mm_unpacklo_epi16(halves, zero), rateV, thresholdV);
+        const __m128i high = decayHalfLanesSSE(_mm_unpackhi_epi16(halves, zero), rateV, thresholdV);
+        _mm_storeu_si128(lanes, _mm_packs_epi32(low, high));
+    }
+    decayHalfScalar(levels, i, count, rate, threshold);
+}
+
+ANTSIM_TARGET_AVX2
+static inline __m256i decayHalfLanesAVX2(__m256i halves, __m256 rate, __m256 threshold) {
+    const __m256i rebase = _mm256_set1_epi32(static_cast<int>(PheromoneKernels::HALF_EXPONENT_REBASE));
+    const __m256 v = _mm256_castsi256_ps(_mm256_add_epi32(_mm256_slli_epi32(halves, 13), rebase));
+    const __m256 decayed = _mm256_mul_ps(v, rate);
+    const __m256 positive = _mm256_castsi256_ps(_mm256_cmpgt_epi32(_mm256_set1_epi32(0x8000), halves));
+    const __m256 keep = _mm256_and_ps(positive,
+        _mm256_and_ps(_mm256_cmp_ps(v, threshold, _CMP_GT_OQ), _mm256_cmp_ps(decayed, threshold, _CMP_GE_OQ)));
+    const __m256i rounded = _mm256_add_epi32(_mm256_sub_epi32(_mm256_castps_si256(decayed), rebase), _mm256_set1_epi32(0x1000));
+    return _mm256_and_si256(_mm256_srli_epi32(rounded, 13), _mm256_castps_si256(keep));
+}
+
+// unpack and pack both work within 128-bit halves, so the pack puts every level back where it came from
+ANTSIM_TARGET_AVX2
+static void decayHalfAVX2(std::uint16_t* levels, size_t count, float rate, float threshold) {
+    const __m256 rateV = _mm256_set1_ps(rate);
+    const __m256 thresholdV = _mm256_set1_ps(threshold);
+    const __m256i zero = _mm256_setzero_si256();
+    size_t i = 0;
+    for (; i + 16 <= count; i += 16) {
+        __m256i* lanes = reinterpret_cast<__m256i*>(levels + i);
+        const __m256i halves = _mm256_loadu_si256(lanes);
+        const __m256i low = decayHalfLanesAVX2(_mm256_unpacklo_epi16(halves, zero), rateV, thresholdV);
+        const __m256i high = decayHalfLanesAVX2(_mm256_unpackhi_epi16(halves, zero), rateV, thresholdV);
+        _mm256_storeu_si256(lanes, _mm256_packs_epi32(low, high));
+    }
+    decayHalfScalar(levels, i, count, rate, threshold);
+}
+
+static bool cpuHasAVX2() {
+#if defined(_MSC_VER)
+    int info[4];
+    __cpuid(info, 0);
+    if (info[0] < 7) return false;
+    __cpuid(info, 1);
+    const bool osxsave = (info[2] & (1 << 27)) != 0;
+    const bool avx = (info[2] & (1 << 28)) != 0;
+    if (!osxsave || !avx) return false;
+    // The OS must save the YMM registers on context switch
+    if ((_xgetbv(0) & 0x6) != 0x6) return false;
+    __cpuidex(info, 7, 0);
+    return (info[1] & (1 << 5)) != 0;
+#else
+    __builtin_cpu_init();
+    return __builtin_cpu_supports("avx2");
+#endif
+}
+
+static bool cpuHasSSE2() {
+#if defined(_M_X64) || defined(__x86_64__)
+    return true; // Part of the x86-64 baseline
+#elif defined(_MSC_VER)
+    int info[4];
+    __cpuid(info, 1);
+    return (info[3] & (1 << 26)) != 0;
+#else
+    __builtin_cpu_init();
+    return __builtin_cpu_supports("sse2");
+#endif
+}
+#endif // ANTSIM_X86
+
+bool PheromoneKernels::isSupported(DecayKernel kernel) {
+    switch (kernel) {
+    case DecayKernel::Scalar: return true;
+#ifdef ANTSIM_X86
+    // CPUID is not free on every compiler, so query once
+    case DecayKernel::SSE: {
+        static const bool hasSSE2 = cpuHasSSE2();
+        return hasSSE2;
+    }
+    case DecayKernel::AVX2: {
+        static const bool hasAVX2 = cpuHasAVX2();
+        return hasAVX2;
+    }
+#endif
+    default: return false;
+    }
+}
+
+PheromoneKernels::DecayKernel PheromoneKernels::bestAvailableKernel() {
+    static const DecayKernel best =
+        isSupported(DecayKernel::AVX2) ? DecayKernel::AVX2 :
+        isSupported(DecayKernel::SSE) ? DecayKernel::SSE :
+        DecayKernel::Scalar;
+    return best;
+}
+
+const char* PheromoneKernels::kernelName(DecayKernel kernel) {
+    switch (kernel) {
+    case DecayKernel::SSE: return "sse";
+    case DecayKernel::AVX2: return "avx2";
+    default: return "scalar";
+    }
+}
+
+void PheromoneKernels::decay(float* foodPheromones, float* homePheromones, size_t cellCount, float rate, float threshold) {
+    decay(bestAvailableKernel(), foodPheromones, homePheromones, cellCount, rate, threshold);
+}
+
+void PheromoneKernels::decay(DecayKernel kernel, float* foodPheromones, float* homePheromones, size_t cellCount, float rate, float threshold) {
+    if (kernel != DecayKernel::Scalar && !isSupported(kernel)) {
+        kernel = bestAvailableKernel();
+    }
+    switch (kernel) {
+#ifdef ANTSIM_X86
+    case DecayKernel::AVX2:
+        decayAVX2(foodPheromones, homePheromones, cellCount, rate, threshold);
+        break;
+    case DecayKernel::SSE:
+        decaySSE(foodPheromones, homePheromones, cellCount, rate, threshold);
+        break;
+#endif
+    default:
+        decayScalar(foodPheromones, homePheromones, 0, cellCount, rate, threshold);
+        break;
+    }
+}
+
+void PheromoneKernels::decayHalf(std::uint16_t* levels, size_t count, float rate, float threshold) {
+    decayHalf(bestAvailableKernel(), levels, count, rate, threshold);
+}
+
+void PheromoneKernels::decayHalf(DecayKernel kernel, std::uint16_t* levels, size_t count, float rate, float threshold) {
+    if (kernel != DecayKernel::Scalar && !isSupported(kernel)) {
+        kernel = bestAvailableKernel();
+    }
+    switch (kernel) {
+#ifdef ANTSIM_X86
+    case DecayKernel::AVX2:
+        decayHalfAVX2(levels, count, rate, threshold);
+        break;
+    case DecayKernel::SSE:
+        decayHalfSSE(levels, count, rate, threshold);
+        break;
+#endif
+    default:
+        decayHalfScalar(levels, 0, count, rate, threshold);
+        break;
+    }
+}
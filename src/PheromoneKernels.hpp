@@ -0,0 +1,77 @@
+// AntSimulation - An SFML simulation of an ant colony.
+// Copyright (C) 2025 Logan Herrera <jherre36@live.nmhu.edu>
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#ifndef PHEROMONE_KERNELS_HPP
+#define PHEROMONE_KERNELS_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+// Pheromone decay kernels.
+// Every kernel applies, per cell, exactly what the original scalar loop did:
+//     if (v > threshold) { v *= rate; if (v < threshold) v = 0; } else { v = 0; }
+// The SIMD versions do it branchless (multiply, compare-mask, blend) and produce bit-identical results.
+// The half kernel applies the same rule to levels stored as 16-bit IEEE half floats (interleaved layout).
+class PheromoneKernels {
+public:
+    enum class DecayKernel {
+        Scalar, // Portable fallback, used on non-x86 targets
+        SSE,    // 4 lanes
+        AVX2    // 8 lanes
+    };
+
+    // Decays both pheromone grids in one fused pass. Both buffers must hold cellCount floats.
+    // Uses the best kernel the CPU supports (detected once at first use).
+    static void decay(float* foodPheromones, float* homePheromones, size_t cellCount, float rate, float threshold);
+
+    // Same as above with an explicit kernel, mainly for benchmarking and verification.
+    // Falls back to the best available kernel if the requested one is not supported.
+    static void decay(DecayKernel kernel, float* foodPheromones, float* homePheromones, size_t cellCount, float rate, float threshold);
+
+    // Decays count half-float levels in place: widen, apply the rule above, round back to half.
+    // Halves with the sign bit set (floatToHalf never makes one) count as negative levels and become 0.
+    static void decayHalf(std::uint16_t* levels, size_t count, float rate, float threshold);
+    static void decayHalf(DecayKernel kernel, std::uint16_t* levels, size_t count, float rate, float threshold);
+
+    // Conversions between float levels and halves, with plain integer arithmetic (no F16C needed).
+    // Only zero and normal halves are produced: anything below the smallest normal half (6.1e-5, far
+    // under any pheromone threshold) is stored as 0, so a non-zero half is just a float with the exponent
+    // rebased and the mantissa cut to 10 bits (rounded to nearest).
+    static constexpr std::uint32_t HALF_EXPONENT_REBASE = (127 - 15) << 23;
+    static constexpr std::uint32_t HALF_MIN_NORMAL_BITS = (127 - 14) << 23;
+    static float halfToFloat(std::uint16_t half) {
+        const std::uint32_t bits = half != 0 ? (static_cast<std::uint32_t>(half) << 13) + HALF_EXPONENT_REBASE : 0;
+        float value;
+        std::memcpy(&value, &bits, sizeof(value));
+        return value;
+    }
+    // value must be below 65504 (pheromone levels are clamped far lower); negative values store 0
+    static std::uint16_t floatToHalf(float value) {
+        std::uint32_t bits;
+        std::memcpy(&bits, &value, sizeof(bits));
+        if (bits < HALF_MIN_NORMAL_BITS || bits >= 0x80000000u) {
+            return 0;
+        }
+        return static_cast<std::uint16_t>((bits - HALF_EXPONENT_REBASE + 0x1000u) >> 13);
+    }
+
+    static DecayKernel bestAvailableKernel();
+    static bool isSupported(DecayKernel kernel);
+    static const char* kernelName(DecayKernel kernel);
+};
+
+#endif // PHEROMONE_KERNELS_HPP
@@ -0,0 +1,126 @@
+// AntSimulation - An SFML simulation of an ant colony.
+// Copyright (C) 2025 Logan Herrera <jherre36@live.nmhu.edu>
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#include "PheromoneOverlay.hpp"
+#include <algorithm>
+#include <cstring>
+#include <iostream>
+
+// Constructor
+PheromoneOverlay::PheromoneOverlay(int width, int height, float cellSize)
+    : m_width(width),
+    m_height(height),
+    m_cellSize(cellSize),
+    m_textureReady(false),
+    m_rowDirty(height, 0),
+    m_rowPainted(height, 0)
+{
+    // Maps larger than the GPU allows in one texture are drawn without trails rather than holding a
+    // full-map pixel buffer that could never be uploaded
+    const unsigned maxSize = sf::Texture::getMaximumSize();
+    if (static_cast<unsigned>(width) > maxSize || static_cast<unsigned>(height) > maxSize) {
+        std::cerr << "Warning: a " << width << "x" << height << " map exceeds the " << maxSize
+            << " pixel texture limit; pheromone trails will not be drawn.\n";
+        return;
+    }
+    m_pixels.assign(static_cast<size_t>(width) * height * 4, 0);
+    if (m_texture.create(static_cast<unsigned>(width), static_cast<unsigned>(height))) {
+        m_texture.update(m_pixels.data()); // Start fully transparent
+        m_textureReady = true;
+    }
+    else {
+        std::cerr << "Warning: could not create a " << width << "x" << height
+            << " pheromone texture; pheromone trails will not be drawn.\n";
+    }
+}
+
+// Writes one cell's color: the food trail composited over the home trail ("over" blending, like drawing
+// the gold square on top of the home square)
+void PheromoneOverlay::paintCell(std::uint64_t cell, float homeLevel, float foodLevel, const sf::Color& colonyColor) {
+    float homeAlpha = 0.0f, foodAlpha = 0.0f;
+    if (homeLevel > VISIBLE_LEVEL) {
+        homeAlpha = std::min(255.0f, homeLevel * HOME_ALPHA_SCALE) / 255.0f;
+    }
+    if (foodLevel > VISIBLE_LEVEL) {
+        foodAlpha = std::min(255.0f, foodLevel * FOOD_ALPHA_SCALE) / 255.0f;
+    }
+
+    const float homeR = static_cast<float>(std::min(255, colonyColor.r + HOME_LIGHTEN));
+    const float homeG = static_cast<float>(std::min(255, colonyColor.g + HOME_LIGHTEN));
+    const float homeB = static_cast<float>(std::min(255, colonyColor.b + HOME_LIGHTEN));
+    const float foodR = 255.0f, foodG = 215.0f, foodB = 0.0f; // Gold
+
+    std::uint8_t* pixel = &m_pixels[static_cast<size_t>(cell) * 4];
+    const float homeWeight = homeAlpha * (1.0f - foodAlpha);
+    const float alpha = foodAlpha + homeWeight;
+    if (alpha <= 0.0f) {
+        pixel[0] = pixel[1] = pixel[2] = pixel[3] = 0;
+        return;
+    }
+    pixel[0] = static_cast<std::uint8_t>((foodR * foodAlpha + homeR * homeWeight) / alpha + 0.5f);
+    pixel[1] = static_cast<std::uint8_t>((foodG * foodAlpha + homeG * homeWeight) / alpha + 0.5f);
+    pixel[2] = static_cast<std::uint8_t>((foodB * foodAlpha + homeB * homeWeight) / alpha + 0.5f);
+    pixel[3] = static_cast<std::uint8_t>(alpha * 255.0f + 0.5f);
+}
+
+void PheromoneOverlay::update(const ColonySnapshot& colony) {
+    if (!m_textureReady) {
+        return;
+    }
+    const size_t rowBytes = static_cast<size_t>(m_width) * 4;
+
+    // Rows painted last frame are cleared: their cells may have decayed away since
+    for (int row = 0; row < m_height; ++row) {
+        m_rowDirty[row] = m_rowPainted[row];
+        if (m_rowPainted[row]) {
+            std::memset(&m_pixels[row * rowBytes], 0, rowBytes);
+            m_rowPainted[row] = 0;
+        }
+    }
+
+    // Only cells holding pheromone are visited; the rest of the grid stays transparent
+    for (size_t i = 0; i < colony.pheromoneCells.size(); ++i) {
+        const std::uint64_t cell = colony.pheromoneCells[i];
+        const int row = static_cast<int>(cell / static_cast<std::uint64_t>(m_width));
+        paintCell(cell, colony.homeLevels[i], colony.foodLevels[i], colony.color);
+        m_rowDirty[row] = 1;
+        m_rowPainted[row] = 1;
+    }
+
+    // Upload each run of consecutive dirty rows with one call
+    for (int row = 0; row < m_height;) {
+        if (!m_rowDirty[row]) {
+            ++row;
+            continue;
+        }
+        int end = row + 1;
+        while (end < m_height && m_rowDirty[end]) {
+            ++end;
+        }
+        m_texture.update(&m_pixels[row * rowBytes], static_cast<unsigned>(m_width), static_cast<unsigned>(end - row),
+            0, static_cast<unsigned>(row));
+        row = end;
+    }
+}
+
+void PheromoneOverlay::draw(sf::RenderTarget& target) const {
+    if (!m_textureReady) {
+        return;
+    }
+    sf::Sprite sprite(m_texture); // Built per draw so the overlay can live in a std::vector
+    sprite.setScale(m_cellSize, m_cellSize);
+    target.draw(sprite);
+}
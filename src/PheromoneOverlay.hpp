@@ -0,0 +1,55 @@
+// AntSimulation - An SFML simulation of an ant colony.
+// Copyright (C) 2025 Logan Herrera <jherre36@live.nmhu.edu>
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#ifndef PHEROMONE_OVERLAY_HPP
+#define PHEROMONE_OVERLAY_HPP
+
+#include "WorldSnapshot.hpp"
+#include <SFML/Graphics.hpp>
+#include <cstdint>
+#include <vector>
+
+// Draws one colony's pheromone trails as a single texture with one texel per grid cell, scaled up to
+// the cell size, instead of one RectangleShape draw per cell.
+// Colors match the old per-cell squares: the home trail is the colony color lightened by 50 with
+// alpha = level * 2.5, and the food trail is gold with alpha = level * 4, drawn over the home trail.
+// Only rows that changed since the last frame are repainted and uploaded to the GPU.
+class PheromoneOverlay {
+public:
+    static constexpr float VISIBLE_LEVEL = 0.01f;   // Levels at or below this are not drawn
+    static constexpr float HOME_ALPHA_SCALE = 2.5f;
+    static constexpr float FOOD_ALPHA_SCALE = 4.0f;
+    static constexpr int HOME_LIGHTEN = 50;
+
+    PheromoneOverlay(int width, int height, float cellSize);
+
+    // Repaints the rows holding pheromone now or on the previous frame, then uploads those rows
+    void update(const ColonySnapshot& colony);
+    void draw(sf::RenderTarget& target) const;
+
+private:
+    int m_width, m_height;
+    float m_cellSize;
+    bool m_textureReady; // False if the GPU could not create a texture this large (the overlay is then skipped)
+    sf::Texture m_texture;
+    std::vector<std::uint8_t> m_pixels;   // RGBA, row-major, mirrors the texture
+    std::vector<std::uint8_t> m_rowDirty; // Rows to upload this frame
+    std::vector<std::uint8_t> m_rowPainted; // Rows with at least one non-transparent pixel in the texture
+
+    void paintCell(std::uint64_t cell, float homeLevel, float foodLevel, const sf::Color& colonyColor);
+};
+
+#endif // PHEROMONE_OVERLAY_HPP
@@ -0,0 +1,73 @@
+// AntSimulation - An SFML simulation of an ant colony.
+// Copyright (C) 2025 Logan Herrera <jherre36@live.nmhu.edu>
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#ifndef POSITION_MEMORY_HPP
+#define POSITION_MEMORY_HPP
+
+#include "Directions.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+// An ant's short term memory of the last Capacity cells it stood on, kept inline as a ring buffer.
+// Cells are stored as the low 16 bits of x and y packed into one 32-bit key. That is exact here: every
+// remembered cell is within Capacity + 1 steps of the ant, so two cells it compares can never be
+// 65536 apart. The type is trivially copyable, so the ant store moves it with a plain memcpy.
+template <size_t Capacity>
+class PositionMemory {
+    static_assert(Capacity > 0 && Capacity < 256, "count and head are stored in a byte");
+
+public:
+    PositionMemory() : m_cells{}, m_count(0), m_head(0) {}
+
+    // Remembers (x, y), forgetting the oldest cell once the memory is full
+    void push(int x, int y) {
+        m_cells[m_head] = pack(x, y);
+        m_head = static_cast<std::uint8_t>(m_head + 1 == Capacity ? 0 : m_head + 1);
+        m_count = static_cast<std::uint8_t>(m_count < Capacity ? m_count + 1 : Capacity);
+    }
+
+    // Bit d is set when the neighbour of (x, y) in direction d is remembered.
+    // Tests all 8 neighbours against every slot without branches, so one call replaces 8 scans.
+    unsigned neighborMask(int x, int y) const {
+        std::uint32_t keys[8];
+        for (int d = 0; d < 8; ++d) {
+            keys[d] = pack(x + Directions::DX[d], y + Directions::DY[d]);
+        }
+        unsigned mask = 0;
+        for (size_t slot = 0; slot < Capacity; ++slot) {
+            const unsigned valid = slot < m_count ? 1u : 0u;
+            for (int d = 0; d < 8; ++d) {
+                mask |= (static_cast<unsigned>(keys[d] == m_cells[slot]) & valid) << d;
+            }
+        }
+        return mask;
+    }
+
+    size_t size() const { return m_count; }
+    bool empty() const { return m_count == 0; }
+
+private:
+    std::uint32_t m_cells[Capacity];
+    std::uint8_t m_count;
+    std::uint8_t m_head; // Slot the next push writes (the oldest cell once full)
+
+    static std::uint32_t pack(int x, int y) {
+        return (static_cast<std::uint32_t>(static_cast<std::uint16_t>(y)) << 16) | static_cast<std::uint16_t>(x);
+    }
+};
+
+#endif // POSITION_MEMORY_HPP
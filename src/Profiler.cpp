@@ -0,0 +1,181 @@
+// AntSimulation - An SFML simulation of an ant colony.
+// Copyright (C) 2025 Logan Herrera <jherre36@live.nmhu.edu>
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+
+#include "Profiler.hpp"
+#include <algorithm>
+#include <cstdio>
+#include <iostream>
+
+// --- ProfileSection ---
+
+ProfileSection::ProfileSection(const std::string& name, size_t id)
+    : m_name(name),
+    m_id(id)
+{
+}
+
+ProfileSection::ThreadBuffer& ProfileSection::localBuffer() {
+    // Sections live for the whole run, so a thread can keep raw pointers to its buffers
+    thread_local std::vector<ThreadBuffer*> buffers;
+    if (m_id >= buffers.size()) {
+        buffers.resize(m_id + 1, nullptr);
+    }
+    ThreadBuffer*& buffer = buffers[m_id];
+    if (buffer == nullptr) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_buffers.push_back(std::make_unique<ThreadBuffer>());
+        buffer = m_buffers.back().get();
+    }
+    return *buffer;
+}
+
+void ProfileSection::record(std::uint64_t nanoseconds) {
+    ThreadBuffer& buffer = localBuffer();
+    const unsigned long long calls = buffer.calls.load(std::memory_order_relaxed);
+    buffer.samples[calls % WINDOW].store(nanoseconds, std::memory_order_relaxed);
+    buffer.calls.store(calls + 1, std::memory_order_release);
+}
+
+void ProfileSection::recordCounters(const PerfSample& delta) {
+    ThreadBuffer& buffer = localBuffer();
+    for (int e = 0; e < PERF_EVENT_COUNT; ++e) {
+        buffer.counterTotals[e].store(buffer.counterTotals[e].load(std::memory_order_relaxed) + delta.value[e], std::memory_order_relaxed);
+    }
+    buffer.counterCalls.store(buffer.counterCalls.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+}
+
+ProfileStats ProfileSection::stats() const {
+    ProfileStats result;
+    result.name = m_name;
+
+    std::vector<std::uint64_t> window;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        window.reserve(m_buffers.size() * WINDOW);
+        for (const auto& buffer : m_buffers) {
+            const unsigned long long calls = buffer->calls.load(std::memory_order_acquire);
+            result.calls += calls;
+            result.counterCalls += buffer->counterCalls.load(std::memory_order_relaxed);
+            for (int e = 0; e < PERF_EVENT_COUNT; ++e) {
+                result.counterTotals.value[e] += buffer->counterTotals[e].load(std::memory_order_relaxed);
+            }
+            const size_t count = static_cast<size_t>(std::min<unsigned long long>(calls, WINDOW));
+            for (size_t i = 0; i < count; ++i) {
+                window.push_back(buffer->samples[i].load(std::memory_order_relaxed));
+            }
+        }
+    }
+    if (window.empty()) {
+        return result;
+    }
+
+    const size_t count = window.size();
+    std::uint64_t total = 0;
+    for (std::uint64_t sample : window) {
+        total += sample;
+    }
+    const size_t p99Index = (count * 99 + 99) / 100 - 1; // Nearest rank
+    std::nth_element(window.begin(), window.begin() + p99Index, window.end());
+    result.p99Us = window[p99Index] / 1000.0;
+    result.minUs = *std::min_element(window.begin(), window.end()) / 1000.0;
+    result.meanUs = static_cast<double>(total) / count / 1000.0;
+    return result;
+}
+
+// --- Profiler ---
+
+Profiler& Profiler::instance() {
+    static Profiler profiler;
+    return profiler;
+}
+
+ProfileSection& Profiler::section(const char* name) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    for (const auto& existing : m_sections) {
+        if (existing->name() == name) {
+            return *existing;
+        }
+    }
+    m_sections.push_back(std::make_unique<ProfileSection>(name, m_sections.size()));
+    return *m_sections.back();
+}
+
+std::vector<ProfileStats> Profiler::stats() const {
+    std::vector<ProfileStats> result;
+    std::lock_guard<std::mutex> lock(m_mutex);
+    result.reserve(m_sections.size());
+    for (const auto& section : m_sections) {
+        result.push_back(section->stats());
+    }
+    return result;
+}
+
+std::string Profiler::formatTable() const {
+#ifndef ANTSIM_PROFILING
+    return "Profiling is compiled out (configure with -DANTSIM_PROFILING=ON)";
+#else
+    std::string table = "phase: min / mean / p99 ms";
+    char line[128];
+    for (const ProfileStats& s : stats()) {
+        std::snprintf(line, sizeof(line), "\n%s: %.3f / %.3f / %.3f", s.name.c_str(), s.minUs / 1000.0, s.meanUs / 1000.0, s.p99Us / 1000.0);
+        table += line;
+    }
+    return table;
+#endif
+}
+
+// --- ProfileLog ---
+
+ProfileLog::ProfileLog(const std::string& path, std::chrono::seconds interval)
+    : m_interval(interval),
+    m_start(std::chrono::steady_clock::now()),
+    m_next(m_start + interval)
+{
+    if (path.empty()) {
+        return;
+    }
+    m_file.open(path, std::ios::out | std::ios::trunc);
+    if (!m_file) {
+        std::cerr << "Warning: could not open profile log " << path << "; timings will not be written.\n";
+        return;
+    }
+#ifndef ANTSIM_PROFILING
+    std::cerr << "Warning: this build has profiling compiled out; " << path << " will only hold the header.\n";
+#endif
+    m_file << "elapsed_s,section,calls,min_us,mean_us,p99_us\n";
+}
+
+void ProfileLog::maybeWrite() {
+    if (!m_file.is_open() || std::chrono::steady_clock::now() < m_next) {
+        return;
+    }
+    write();
+}
+
+void ProfileLog::write() {
+    if (!m_file.is_open()) {
+        return;
+    }
+    const auto now = std::chrono::steady_clock::now();
+    m_next = now + m_interval;
+    const double elapsed = std::chrono::duration<double>(now - m_start).count();
+    for (const ProfileStats& s : Profiler::instance().stats()) {
+        m_file << elapsed << ',' << s.name << ',' << s.calls << ','
+            << s.minUs << ',' << s.meanUs << ',' << s.p99Us << '\n';
+    }
+    m_file.flush(); // So the file is useful even if the run is killed
+}
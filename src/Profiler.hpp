@@ -0,0 +1,178 @@
+// AntSimulation - An SFML simulation of an ant colony.
+// Copyright (C) 2025 Logan Herrera <jherre36@live.nmhu.edu>
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+
+#ifndef PROFILER_HPP
+#define PROFILER_HPP
+
+#include "PerfCounters.hpp"
+#include "TraceRecorder.hpp"
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+// Lightweight per-phase timing.
+// Wrap a phase in ANTSIM_PROFILE_SCOPE("name") and every pass through it is timed into the section of
+// that name. Each section keeps the last WINDOW samples of every thread that runs it, from which the HUD
+// panel and the profile log compute rolling min / mean / p99. Scopes can run on any thread (simulation,
+// workers, render); each thread writes its own buffer without locking and readers merge the buffers.
+// Built with ANTSIM_PROFILING off (the CMake default), the macro expands to nothing and costs nothing.
+
+// Rolling statistics of one section, in microseconds
+struct ProfileStats {
+    std::string name;
+    unsigned long long calls = 0; // Since start, not just the window
+    double minUs = 0.0;
+    double meanUs = 0.0;
+    double p99Us = 0.0;
+
+    // Hardware counter totals over every call that had counters (--perf-counters), not just the window
+    unsigned long long counterCalls = 0;
+    PerfSample counterTotals;
+};
+
+class ProfileSection {
+public:
+    static constexpr size_t WINDOW = 256; // Samples kept for the rolling statistics
+
+    ProfileSection(const std::string& name, size_t id);
+
+    const std::string& name() const { return m_name; }
+    // Writers never lock (after a thread's first call into the section)
+    void record(std::uint64_t nanoseconds);
+    void recordCounters(const PerfSample& delta);
+    // Merges every thread's buffer; a sample being overwritten while it is read is simply a newer one
+    ProfileStats stats() const;
+
+private:
+    // One writer thread's samples. Only that thread stores; relaxed atomics let readers load concurrently.
+    struct ThreadBuffer {
+        std::array<std::atomic<std::uint64_t>, WINDOW> samples{};
+        std::atomic<unsigned long long> calls{ 0 };
+        std::atomic<unsigned long long> counterCalls{ 0 };
+        std::array<std::atomic<std::uint64_t>, PERF_EVENT_COUNT> counterTotals{};
+    };
+
+    // The calling thread's buffer, created (under m_mutex) on its first call
+    ThreadBuffer& localBuffer();
+
+    std::string m_name;
+    size_t m_id; // Index into each thread's buffer cache
+    mutable std::mutex m_mutex; // Guards m_buffers; taken once per writer thread and by readers
+    std::vector<std::unique_ptr<ThreadBuffer>> m_buffers;
+};
+
+class Profiler {
+public:
+    static Profiler& instance();
+
+    // The section called name, created on first use. The reference stays valid for the whole run.
+    ProfileSection& section(const char* name);
+
+    // Statistics of every section, in the order they were first used
+    std::vector<ProfileStats> stats() const;
+
+    // Multi-line "name  min / mean / p99" table for the HUD panel
+    std::string formatTable() const;
+
+private:
+    Profiler() = default;
+    mutable std::mutex m_mutex;
+    std::vector<std::unique_ptr<ProfileSection>> m_sections;
+};
+
+// Records the time between construction and destruction into a section (and the trace, if one is running).
+// With --perf-counters the thread's hardware counters are read at both ends as well.
+class ScopedTimer {
+public:
+    explicit ScopedTimer(ProfileSection& section, std::int64_t traceArg = TraceEvent::NO_ARG)
+        : m_section(section),
+        m_traceArg(traceArg),
+        m_counters(PerfCounters::enabled() ? &PerfCounters::forThisThread() : nullptr)
+    {
+        if (m_counters != nullptr && !m_counters->read(m_counterStart)) {
+            m_counters = nullptr;
+        }
+        m_start = std::chrono::steady_clock::now();
+    }
+    ~ScopedTimer() {
+        const auto end = std::chrono::steady_clock::now();
+        PerfSample counterEnd;
+        if (m_counters != nullptr && m_counters->read(counterEnd)) {
+            m_section.recordCounters(counterEnd - m_counterStart);
+        }
+        m_section.record(static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(end - m_start).count()));
+        if (TraceRecorder::isActive()) {
+            TraceRecorder::instance().record(m_section.name().c_str(), m_traceArg, m_start, end);
+        }
+    }
+
+    ScopedTimer(const ScopedTimer&) = delete;
+    ScopedTimer& operator=(const ScopedTimer&) = delete;
+
+private:
+    ProfileSection& m_section;
+    std::int64_t m_traceArg;
+    PerfCounters* m_counters;
+    PerfSample m_counterStart;
+    std::chrono::steady_clock::time_point m_start;
+};
+
+// Appends the statistics of every section to a CSV file at a fixed interval (--profile-log)
+class ProfileLog {
+public:
+    static constexpr std::chrono::seconds DEFAULT_INTERVAL{ 5 };
+
+    // An empty path disables the log
+    explicit ProfileLog(const std::string& path, std::chrono::seconds interval = DEFAULT_INTERVAL);
+
+    bool isOpen() const { return m_file.is_open(); }
+
+    // Writes a block of rows if the interval has passed (cheap to call every tick or frame)
+    void maybeWrite();
+    // Writes a block of rows now
+    void write();
+
+private:
+    std::ofstream m_file;
+    std::chrono::seconds m_interval;
+    std::chrono::steady_clock::time_point m_start;
+    std::chrono::steady_clock::time_point m_next;
+};
+
+#ifdef ANTSIM_PROFILING
+#define ANTSIM_PROFILE_CONCAT_INNER(a, b) a##b
+#define ANTSIM_PROFILE_CONCAT(a, b) ANTSIM_PROFILE_CONCAT_INNER(a, b)
+// The section is looked up once per call site (thread-safe static), so a pass costs two clock reads
+#define ANTSIM_PROFILE_SCOPE(name) \
+    static ProfileSection& ANTSIM_PROFILE_CONCAT(antsimProfileSection, __LINE__) = Profiler::instance().section(name); \
+    ScopedTimer ANTSIM_PROFILE_CONCAT(antsimProfileTimer, __LINE__)(ANTSIM_PROFILE_CONCAT(antsimProfileSection, __LINE__))
+// Same, and tags the trace event with a number (e.g. the colony index)
+#define ANTSIM_PROFILE_SCOPE_ID(name, id) \
+    static ProfileSection& ANTSIM_PROFILE_CONCAT(antsimProfileSection, __LINE__) = Profiler::instance().section(name); \
+    ScopedTimer ANTSIM_PROFILE_CONCAT(antsimProfileTimer, __LINE__)(ANTSIM_PROFILE_CONCAT(antsimProfileSection, __LINE__), static_cast<std::int64_t>(id))
+#else
+#define ANTSIM_PROFILE_SCOPE(name) ((void)0)
+#define ANTSIM_PROFILE_SCOPE_ID(name, id) ((void)0)
+#endif
+
+#endif // PROFILER_HPP
@@ -17,15 +17,101 @@
 #ifndef RANDOM_UTILS_HPP
 #define RANDOM_UTILS_HPP
 
-#include <random>
+#include <cstdint>
 
-class RandomUtils {
+// Counter-based random stream (Philox4x32-10).
+// A stream is fully determined by its key - (seed, tick, colony, ant, purpose) - so every ant gets its own
+// reproducible numbers each tick no matter which thread updates it or in what order. There is no shared
+// engine state to lock or to carry between ticks; constructing a stream is a handful of integer stores.
+class CounterRng {
 public:
-    static std::mt19937& getGenerator() {
-        static std::random_device rd;
-        static std::mt19937 gen(rd()); // Ensures one instance across all files
-        return gen;
+    // Separates independent uses of the same (tick, colony, ant) so they never share numbers
+    enum Stream : std::uint32_t {
+        AntUpdate = 0,
+        AntSpawn = 1,
+        World = 2 // Food and colony placement; 'tick' is the world (reset) number
+    };
+
+    CounterRng(std::uint64_t seed, std::uint64_t tick, std::uint32_t colonyID, std::uint32_t antID, Stream stream)
+        : m_key{ static_cast<std::uint32_t>(seed), static_cast<std::uint32_t>(seed >> 32) },
+        m_counter{ 0, antID, colonyID, static_cast<std::uint32_t>(tick) },
+        m_buffer{},
+        m_bufferPos(4)
+    {
+        // The high tick bits and the purpose are folded into the key; the first counter word counts blocks
+        m_key[1] ^= static_cast<std::uint32_t>(tick >> 32) * 0x9E3779B9u + static_cast<std::uint32_t>(stream) * 0x85EBCA6Bu;
+    }
+
+    // Next 32 random bits
+    std::uint32_t operator()() {
+        if (m_bufferPos == 4) {
+            refill();
+        }
+        return m_buffer[m_bufferPos++];
+    }
+
+    // Uniform integer in [0, bound) using Lemire's multiply-shift; the rejection step keeps it unbiased
+    // and almost never runs for the small bounds ants use. bound must be > 0.
+    std::uint32_t below(std::uint32_t bound) {
+        std::uint64_t product = static_cast<std::uint64_t>((*this)()) * bound;
+        std::uint32_t low = static_cast<std::uint32_t>(product);
+        if (low < bound) {
+            const std::uint32_t threshold = (0u - bound) % bound;
+            while (low < threshold) {
+                product = static_cast<std::uint64_t>((*this)()) * bound;
+                low = static_cast<std::uint32_t>(product);
+            }
+        }
+        return static_cast<std::uint32_t>(product >> 32);
+    }
+
+    // Uniform integer in [0, maxValue] (inclusive, like the old Ant::generateRand)
+    int upTo(int maxValue) {
+        return static_cast<int>(below(static_cast<std::uint32_t>(maxValue) + 1u));
+    }
+
+    // Uniform float in [0, 1) with 24 bits of precision
+    float uniform() {
+        return static_cast<float>((*this)() >> 8) * (1.0f / 16777216.0f);
+    }
+
+    // Uniform float in [lo, hi)
+    float uniform(float lo, float hi) {
+        return lo + (hi - lo) * uniform();
+    }
+
+private:
+    std::uint32_t m_key[2];
+    std::uint32_t m_counter[4];
+    std::uint32_t m_buffer[4];
+    unsigned m_bufferPos;
+
+    static constexpr std::uint32_t PHILOX_M0 = 0xD2511F53u;
+    static constexpr std::uint32_t PHILOX_M1 = 0xCD9E8D57u;
+    static constexpr std::uint32_t PHILOX_W0 = 0x9E3779B9u;
+    static constexpr std::uint32_t PHILOX_W1 = 0xBB67AE85u;
+    static constexpr int PHILOX_ROUNDS = 10;
+
+    // Encrypts the current counter into four fresh outputs and advances the counter
+    void refill() {
+        std::uint32_t c0 = m_counter[0], c1 = m_counter[1], c2 = m_counter[2], c3 = m_counter[3];
+        std::uint32_t k0 = m_key[0], k1 = m_key[1];
+        for (int round = 0; round < PHILOX_ROUNDS; ++round) {
+            const std::uint64_t p0 = static_cast<std::uint64_t>(PHILOX_M0) * c0;
+            const std::uint64_t p1 = static_cast<std::uint64_t>(PHILOX_M1) * c2;
+            const std::uint32_t n0 = static_cast<std::uint32_t>(p1 >> 32) ^ c1 ^ k0;
+            const std::uint32_t n2 = static_cast<std::uint32_t>(p0 >> 32) ^ c3 ^ k1;
+            c1 = static_cast<std::uint32_t>(p1);
+            c3 = static_cast<std::uint32_t>(p0);
+            c0 = n0;
+            c2 = n2;
+            k0 += PHILOX_W0;
+            k1 += PHILOX_W1;
+        }
+        m_buffer[0] = c0; m_buffer[1] = c1; m_buffer[2] = c2; m_buffer[3] = c3;
+        m_bufferPos = 0;
+        m_counter[0]++;
     }
 };
 
-#endif // RANDOM_UTILS_HPP
\ No newline at end of file
+#endif // RANDOM_UTILS_HPP
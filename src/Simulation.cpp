@@ -0,0 +1,151 @@
+// AntSimulation - An SFML simulation of an ant colony.
+// Copyright (C) 2025 Logan Herrera <jherre36@live.nmhu.edu>
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#include "Simulation.hpp"
+#include "Ant.hpp"
+#include "Profiler.hpp"
+#include "RandomUtils.hpp"
+
+// Constructor
+Simulation::Simulation(const SimulationOptions& options, float cellSize)
+    : env(cellSize, options.gridWidth, options.gridHeight, options.worldStorage),
+    m_options(options),
+    m_tickCount(0),
+    m_worldCount(0)
+{
+    if (options.threads != 1) {
+        m_threadPool = std::make_unique<ThreadPool>(options.threads == 0 ? ThreadPool::hardwareThreads() : options.threads);
+    }
+    if (options.pheromoneLayout == PheromoneLayout::Interleaved) {
+        m_sharedPheromones = std::make_unique<InterleavedPheromones>(options.gridWidth, options.gridHeight);
+    }
+    reset();
+}
+
+static_assert(Simulation::NUM_COLONIES <= InterleavedPheromones::MAX_COLONIES, "every colony needs its own interleaved channels");
+
+void Simulation::createColonies(CounterRng& rng, std::uint64_t colonySeed) {
+    colonies.clear();
+    colonies.reserve(NUM_COLONIES);
+    Colony::nextColonyID = 0;
+
+    // Lighter color palette
+    const sf::Color colonyColors[NUM_COLONIES] = {
+        sf::Color(128, 128, 128), // A medium-light grey instead of black
+        sf::Color(255, 100, 100), // A lighter red
+        sf::Color(100, 100, 255)  // A lighter blue
+    };
+
+    for (const sf::Color& color : colonyColors) {
+        int homeX = rng.upTo(env.width - 1);
+        int homeY = rng.upTo(env.height - 1);
+        colonies.emplace_back(homeX, homeY, INITIAL_ANTS_PER_COLONY, color, Colony::nextColonyID++,
+            env.width, env.height, m_options.decayMode, colonySeed, m_options.worldStorage, m_sharedPheromones.get());
+    }
+}
+
+void Simulation::forEach(size_t count, const std::function<void(size_t)>& task) {
+    if (m_threadPool) {
+        m_threadPool->parallelFor(count, task);
+        return;
+    }
+    for (size_t i = 0; i < count; ++i) {
+        task(i);
+    }
+}
+
+void Simulation::step() {
+    ANTSIM_PROFILE_SCOPE("tick");
+    // Flatten the ant blocks of every colony into one work list so small and large colonies share the threads
+    m_antBlocks.clear();
+    for (size_t c = 0; c < colonies.size(); ++c) {
+        const size_t blockCount = colonies[c].beginTick();
+        for (size_t block = 0; block < blockCount; ++block) {
+            m_antBlocks.emplace_back(c, block);
+        }
+    }
+
+    // Pheromones and food are only read until every ant has decided
+    {
+        ANTSIM_PROFILE_SCOPE("tick.ant_updates");
+        forEach(m_antBlocks.size(), [this](size_t i) {
+            ANTSIM_PROFILE_SCOPE_ID("colony.ant_block", m_antBlocks[i].first);
+            colonies[m_antBlocks[i].first].updateAntBlock(m_antBlocks[i].second, env);
+        });
+    }
+    {
+        ANTSIM_PROFILE_SCOPE("tick.apply_intents");
+        forEach(colonies.size(), [this](size_t i) {
+            ANTSIM_TRACE_SCOPE("colony.apply_intents", i);
+            colonies[i].applyIntents();
+        });
+    }
+    // Colonies share the food grid, so pickups are resolved one colony at a time
+    {
+        ANTSIM_PROFILE_SCOPE("tick.food_claims");
+        for (size_t c = 0; c < colonies.size(); ++c) {
+            ANTSIM_TRACE_SCOPE("colony.food_claims", c);
+            colonies[c].resolveFoodClaims(env);
+        }
+    }
+    {
+        ANTSIM_PROFILE_SCOPE("tick.finish");
+        forEach(colonies.size(), [this](size_t i) {
+            ANTSIM_TRACE_SCOPE("colony.finish", i);
+            colonies[i].finishTick();
+        });
+    }
+    m_tickCount++;
+}
+
+void Simulation::reset() {
+    // Ant streams restart at tick 0 in every world, so each world also gets its own colony seed
+    const std::uint64_t world = m_worldCount++;
+    CounterRng rng(m_options.seed, world, 0, 0, CounterRng::World);
+    env.generateFood(rng);
+    if (m_sharedPheromones) {
+        m_sharedPheromones->clear();
+    }
+    createColonies(rng, m_options.seed ^ (world * 0x9E3779B97F4A7C15ull));
+}
+
+bool Simulation::isFinished() const {
+    return env.totalFoodSources == 0 || totalLiveAnts() == 0;
+}
+
+long long Simulation::totalLiveAnts() const {
+    long long total = 0;
+    for (const auto& colony : colonies) {
+        total += colony.ants.size();
+    }
+    return total;
+}
+
+size_t Simulation::activePheromoneCells() const {
+    size_t total = 0;
+    for (const auto& colony : colonies) {
+        total += colony.pheromones.activeCellCount();
+    }
+    return total;
+}
+
+size_t Simulation::worldMemoryBytes() const {
+    size_t total = env.foodMemoryBytes() + (m_sharedPheromones ? m_sharedPheromones->memoryBytes() : 0);
+    for (const auto& colony : colonies) {
+        total += colony.pheromones.memoryBytes() + colony.homeField.memoryBytes();
+    }
+    return total;
+}
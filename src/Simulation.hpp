@@ -0,0 +1,83 @@
+// AntSimulation - An SFML simulation of an ant colony.
+// Copyright (C) 2025 Logan Herrera <jherre36@live.nmhu.edu>
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#ifndef SIMULATION_HPP
+#define SIMULATION_HPP
+
+#include "Colony.hpp"
+#include "Environment.hpp"
+#include "InterleavedPheromones.hpp"
+#include "Options.hpp"
+#include "ThreadPool.hpp"
+#include <SFML/Graphics.hpp>
+#include <functional>
+#include <memory>
+#include <utility>
+#include <vector>
+
+// Owns the world state (environment + colonies) and advances it one tick at a time.
+// Both the windowed front end and the headless runner drive the simulation through this class,
+// so neither of them needs to know how colonies are created or reset.
+class Simulation {
+public:
+    static constexpr int NUM_COLONIES = 3;
+    static constexpr int INITIAL_ANTS_PER_COLONY = 5;
+
+    Environment env;
+    std::vector<Colony> colonies;
+
+    // World size and pheromone settings come from options. cellSize is the on-screen size of one cell.
+    Simulation(const SimulationOptions& options, float cellSize);
+
+    Simulation(const Simulation&) = delete;
+    Simulation& operator=(const Simulation&) = delete;
+
+    // Advance every colony by one tick.
+    // Ant blocks of all colonies decide concurrently against last tick's state; their intents are then
+    // merged in colony and ant order, so the result does not depend on the number of threads.
+    void step();
+
+    // Regenerate food and recreate all colonies at new random positions.
+    // Every world (the first one and each reset) has its own number, so a seed replays the whole sequence.
+    void reset();
+
+    // True once all food is gone or every ant has died (the reset condition)
+    bool isFinished() const;
+
+    long long totalLiveAnts() const;
+    // Cells holding pheromone, summed over all colonies
+    size_t activePheromoneCells() const;
+    // Bytes held by the food grid, every colony's pheromone field and home table, plus the shared grid of the
+    // Interleaved layout (grows with the explored area in Tiled storage)
+    size_t worldMemoryBytes() const;
+    unsigned long long getTickCount() const { return m_tickCount; }
+    unsigned long long getWorldCount() const { return m_worldCount; }
+
+private:
+    SimulationOptions m_options;
+    unsigned long long m_tickCount;
+    unsigned long long m_worldCount; // Worlds generated so far; keys the World random stream
+    std::unique_ptr<ThreadPool> m_threadPool; // Only created for parallel ticks
+    std::unique_ptr<InterleavedPheromones> m_sharedPheromones; // Only created for PheromoneLayout::Interleaved
+    std::vector<std::pair<size_t, size_t>> m_antBlocks; // (colony, block) work items for the current tick
+
+    // Runs task(0..count-1) on the thread pool, or inline for serial ticks
+    void forEach(size_t count, const std::function<void(size_t)>& task);
+
+    void createColonies(CounterRng& rng, std::uint64_t colonySeed);
+};
+
+#endif // SIMULATION_HPP
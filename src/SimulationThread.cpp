@@ -0,0 +1,93 @@
+// AntSimulation - An SFML simulation of an ant colony.
+// Copyright (C) 2025 Logan Herrera <jherre36@live.nmhu.edu>
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#include "SimulationThread.hpp"
+#include "Profiler.hpp"
+#include <iostream>
+
+// Constructor
+SimulationThread::SimulationThread(const SimulationOptions& options, float cellSize)
+    : m_sim(options, cellSize),
+    m_resetRequested(false),
+    m_stopping(false)
+{
+    publish(false, 0.0f);
+    m_snapshots.acquire(); // The window has something to draw before the first tick
+    m_thread = std::thread(&SimulationThread::run, this);
+}
+
+// Destructor
+SimulationThread::~SimulationThread() {
+    m_stopping.store(true);
+    if (m_thread.joinable()) {
+        m_thread.join();
+    }
+}
+
+const WorldSnapshot& SimulationThread::latestSnapshot() {
+    m_snapshots.acquire();
+    return m_snapshots.readBuffer();
+}
+
+void SimulationThread::publish(bool waitingForReset, float resetSecondsRemaining) {
+    ANTSIM_PROFILE_SCOPE("snapshot.capture");
+    WorldSnapshot& snapshot = m_snapshots.writeBuffer();
+    snapshot.capture(m_sim);
+    snapshot.waitingForReset = waitingForReset;
+    snapshot.resetSecondsRemaining = resetSecondsRemaining;
+    m_snapshots.publish();
+}
+
+void SimulationThread::run() {
+    TraceRecorder::setThreadName("simulation");
+    using Clock = std::chrono::steady_clock;
+    bool waitingForReset = false;
+    Clock::time_point resetAt;
+    Clock::time_point nextTick = Clock::now();
+
+    while (!m_stopping.load()) {
+        const Clock::time_point now = Clock::now();
+
+        if (m_resetRequested.exchange(false)) {
+            m_sim.reset();
+            waitingForReset = false;
+            std::cout << "Simulation reset.\n";
+        }
+        else if (!waitingForReset) {
+            m_sim.step();
+            if (m_sim.isFinished()) {
+                waitingForReset = true;
+                resetAt = now + RESET_DELAY;
+                std::cout << "Reset condition met. Restarting in " << RESET_DELAY.count() << " seconds...\n";
+            }
+        }
+        else if (now >= resetAt) {
+            m_sim.reset();
+            waitingForReset = false;
+            std::cout << "Simulation restarted.\n";
+        }
+
+        const float secondsRemaining = waitingForReset ? std::chrono::duration<float>(resetAt - now).count() : 0.0f;
+        publish(waitingForReset, secondsRemaining);
+
+        // Fixed timestep; if a tick overran, start counting again from now instead of bursting to catch up
+        nextTick += TICK_INTERVAL;
+        if (nextTick < Clock::now()) {
+            nextTick = Clock::now();
+        }
+        std::this_thread::sleep_until(nextTick);
+    }
+}
@@ -0,0 +1,61 @@
+// AntSimulation - An SFML simulation of an ant colony.
+// Copyright (C) 2025 Logan Herrera <jherre36@live.nmhu.edu>
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#ifndef SIMULATION_THREAD_HPP
+#define SIMULATION_THREAD_HPP
+
+#include "Options.hpp"
+#include "Simulation.hpp"
+#include "TripleBuffer.hpp"
+#include "WorldSnapshot.hpp"
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+// Runs a Simulation on its own thread at a fixed timestep and publishes a WorldSnapshot after every tick.
+// The window thread only ever reads snapshots, so a slow frame never delays a tick and a heavy tick never
+// blocks pan and zoom. The reset countdown (once all food is gone or every ant died) also runs here, and the
+// window can ask for an immediate reset with requestReset().
+class SimulationThread {
+public:
+    static constexpr std::chrono::milliseconds TICK_INTERVAL{ 50 };  // Fixed timestep (20 ticks per second)
+    static constexpr std::chrono::seconds RESET_DELAY{ 3 };          // Pause before restarting a finished world
+
+    // Creates the simulation and publishes the first snapshot; the thread starts ticking right away
+    SimulationThread(const SimulationOptions& options, float cellSize);
+    ~SimulationThread(); // Stops and joins the thread
+
+    SimulationThread(const SimulationThread&) = delete;
+    SimulationThread& operator=(const SimulationThread&) = delete;
+
+    // --- Called from the window thread ---
+    // The newest complete snapshot; valid until the next call
+    const WorldSnapshot& latestSnapshot();
+    // Regenerates the world on the simulation thread before its next tick
+    void requestReset() { m_resetRequested.store(true); }
+
+private:
+    Simulation m_sim;                      // Only touched by the simulation thread once it has started
+    TripleBuffer<WorldSnapshot> m_snapshots;
+    std::atomic<bool> m_resetRequested;
+    std::atomic<bool> m_stopping;
+    std::thread m_thread;
+
+    void run();
+    void publish(bool waitingForReset, float resetSecondsRemaining);
+};
+
+#endif // SIMULATION_THREAD_HPP
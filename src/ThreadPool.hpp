@@ -0,0 +1,65 @@
+// AntSimulation - An SFML simulation of an ant colony.
+// Copyright (C) 2025 Logan Herrera <jherre36@live.nmhu.edu>
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#ifndef THREAD_POOL_HPP
+#define THREAD_POOL_HPP
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// Fixed-size pool of worker threads for fork/join style loops.
+// The calling thread takes part in every parallelFor, so a pool of N threads spawns N - 1 workers.
+class ThreadPool {
+public:
+    explicit ThreadPool(unsigned threadCount);
+    ~ThreadPool();
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    // Total number of threads that run tasks, including the caller
+    unsigned size() const { return static_cast<unsigned>(m_workers.size()) + 1; }
+
+    // Runs task(i) for every i in [0, count) across the pool and returns once all of them finished.
+    // Indices are handed out dynamically, so tasks must not depend on which thread runs them.
+    void parallelFor(size_t count, const std::function<void(size_t)>& task);
+
+    // Number of threads to use when the user asks for "all cores"
+    static unsigned hardwareThreads();
+
+private:
+    std::vector<std::thread> m_workers;
+    std::mutex m_mutex;
+    std::condition_variable m_wakeWorkers;
+    std::condition_variable m_workDone;
+
+    const std::function<void(size_t)>* m_task;
+    size_t m_count;
+    std::atomic<size_t> m_nextIndex;
+    unsigned m_busyWorkers;
+    unsigned long long m_generation; // Bumped for every parallelFor so workers know there is new work
+    bool m_stopping;
+
+    void workerLoop(unsigned workerIndex);
+    void runTasks();
+};
+
+#endif // THREAD_POOL_HPP
@@ -0,0 +1,163 @@
+// AntSimulation - An SFML simulation of an ant colony.
+// Copyright (C) 2025 Logan Herrera <jherre36@live.nmhu.edu>
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+
+#ifndef TILED_GRID_HPP
+#define TILED_GRID_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+// How per-cell world state (food, pheromone trails) is stored
+enum class WorldStorage {
+    Dense, // One contiguous Grid per layer: the fastest reads, memory follows the map size
+    Tiled  // Fixed-size chunks allocated on first write and pooled once empty: memory follows the explored area
+};
+
+// Chunk geometry shared by every tiled layer, so chunk-sized kernels and arrays can be declared up front
+struct TileShape {
+    static constexpr int SHIFT = 6;
+    static constexpr int SIZE = 1 << SHIFT;     // 64 x 64 cells per chunk
+    static constexpr int CELLS = SIZE * SIZE;
+
+    // Position of (x, y) inside its chunk, row-major
+    static int cellInChunk(int x, int y) {
+        return ((y & (SIZE - 1)) << SHIFT) | (x & (SIZE - 1));
+    }
+};
+
+// Sparse 2D grid of Chunk objects, one per SIZE x SIZE block of cells.
+// Only a table of chunk pointers is sized to the map; a chunk is allocated the first time something is
+// written into its block and handed back to a small pool once its owner reports it empty, so a huge map
+// costs memory only where something actually happened. Reads of a block that has no chunk mean "empty".
+// Chunk must be default constructible to an empty state and provide clear() to return to it.
+template <typename Chunk>
+class TiledGrid {
+public:
+    static constexpr size_t MAX_POOLED_CHUNKS = 256; // Released chunks kept for reuse; the rest are freed
+
+    TiledGrid() : m_width(0), m_height(0), m_chunksX(0), m_chunksY(0) {}
+    TiledGrid(int width, int height)
+        : m_width(width),
+        m_height(height),
+        m_chunksX((width + TileShape::SIZE - 1) >> TileShape::SHIFT),
+        m_chunksY((height + TileShape::SIZE - 1) >> TileShape::SHIFT),
+        m_table(static_cast<size_t>(m_chunksX) * m_chunksY)
+    {
+    }
+
+    int width() const { return m_width; }
+    int height() const { return m_height; }
+
+    bool inBounds(int x, int y) const {
+        return x >= 0 && x < m_width && y >= 0 && y < m_height;
+    }
+
+    std::uint32_t chunkIndex(int x, int y) const {
+        return static_cast<std::uint32_t>((y >> TileShape::SHIFT) * m_chunksX + (x >> TileShape::SHIFT));
+    }
+    // Top-left cell of a chunk
+    int chunkOriginX(std::uint32_t chunk) const { return static_cast<int>(chunk % m_chunksX) << TileShape::SHIFT; }
+    int chunkOriginY(std::uint32_t chunk) const { return static_cast<int>(chunk / m_chunksX) << TileShape::SHIFT; }
+
+    // Chunk holding (x, y), or nullptr if its block is empty. Unchecked: (x, y) must be in bounds.
+    const Chunk* find(int x, int y) const { return m_table[chunkIndex(x, y)].get(); }
+    Chunk* find(int x, int y) { return m_table[chunkIndex(x, y)].get(); }
+
+    // Chunk holding (x, y), taking an empty one from the pool (or allocating one) if the block has none
+    Chunk& obtain(int x, int y) {
+        const std::uint32_t chunk = chunkIndex(x, y);
+        std::unique_ptr<Chunk>& slot = m_table[chunk];
+        if (!slot) {
+            if (!m_pool.empty()) {
+                slot = std::move(m_pool.back());
+                m_pool.pop_back();
+                slot->clear();
+            }
+            else {
+                slot.reset(new Chunk());
+            }
+            m_allocated.push_back(chunk);
+        }
+        return *slot;
+    }
+
+    // Allocated chunks (by chunk index) in the order they were allocated
+    const std::vector<std::uint32_t>& allocatedChunks() const { return m_allocated; }
+    Chunk& chunkAt(std::uint32_t chunk) { return *m_table[chunk]; }
+    const Chunk& chunkAt(std::uint32_t chunk) const { return *m_table[chunk]; }
+
+    // Visits every allocated chunk in allocation order and releases those for which shouldRelease(chunk)
+    // returns true, keeping the order of the rest
+    template <typename Predicate>
+    void releaseIf(Predicate shouldRelease) {
+        size_t kept = 0;
+        for (size_t i = 0; i < m_allocated.size(); ++i) {
+            const std::uint32_t chunk = m_allocated[i];
+            if (shouldRelease(*m_table[chunk])) {
+                recycle(m_table[chunk]);
+            }
+            else {
+                m_allocated[kept++] = chunk;
+            }
+        }
+        m_allocated.resize(kept);
+    }
+
+    // Releases the chunk holding (x, y), if any. Linear in the number of allocated chunks.
+    void release(int x, int y) {
+        const std::uint32_t chunk = chunkIndex(x, y);
+        if (!m_table[chunk]) {
+            return;
+        }
+        recycle(m_table[chunk]);
+        m_allocated.erase(std::find(m_allocated.begin(), m_allocated.end(), chunk));
+    }
+
+    void releaseAll() {
+        for (std::uint32_t chunk : m_allocated) {
+            recycle(m_table[chunk]);
+        }
+        m_allocated.clear();
+    }
+
+    size_t allocatedChunkCount() const { return m_allocated.size(); }
+    // Bytes held: chunk table, allocated chunks and pooled chunks
+    size_t memoryBytes() const {
+        return m_table.size() * sizeof(m_table[0]) + (m_allocated.size() + m_pool.size()) * sizeof(Chunk);
+    }
+
+private:
+    int m_width, m_height;
+    int m_chunksX, m_chunksY;
+    std::vector<std::unique_ptr<Chunk>> m_table; // One slot per block, row-major; null = empty
+    std::vector<std::unique_ptr<Chunk>> m_pool;  // Released chunks waiting for reuse (cleared on reuse)
+    std::vector<std::uint32_t> m_allocated;
+
+    void recycle(std::unique_ptr<Chunk>& slot) {
+        if (m_pool.size() < MAX_POOLED_CHUNKS) {
+            m_pool.push_back(std::move(slot));
+        }
+        else {
+            slot.reset();
+        }
+    }
+};
+
+#endif // TILED_GRID_HPP
@@ -0,0 +1,205 @@
+// AntSimulation - An SFML simulation of an ant colony.
+// Copyright (C) 2025 Logan Herrera <jherre36@live.nmhu.edu>
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+
+#include "TraceRecorder.hpp"
+#include <cstdio>
+#include <iostream>
+
+std::atomic<bool> TraceRecorder::s_active{ false };
+
+namespace {
+thread_local TraceRing* t_ring = nullptr;
+thread_local std::string t_threadName;
+
+std::string escapeJson(const std::string& text) {
+    std::string out;
+    for (char c : text) {
+        if (c == '"' || c == '\\') out += '\\';
+        out += c;
+    }
+    return out;
+}
+}
+
+// --- TraceRing ---
+
+TraceRing::TraceRing(std::uint32_t threadID, const std::string& threadName)
+    : m_threadID(threadID),
+    m_threadName(threadName),
+    m_events(CAPACITY),
+    m_head(0),
+    m_tail(0),
+    m_dropped(0)
+{
+}
+
+bool TraceRing::push(const TraceEvent& event) {
+    const size_t head = m_head.load(std::memory_order_relaxed);
+    if (head - m_tail.load(std::memory_order_acquire) == CAPACITY) {
+        m_dropped.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+    m_events[head & (CAPACITY - 1)] = event;
+    m_head.store(head + 1, std::memory_order_release);
+    return true;
+}
+
+// --- TraceRecorder ---
+
+TraceRecorder& TraceRecorder::instance() {
+    static TraceRecorder recorder;
+    return recorder;
+}
+
+TraceRecorder::~TraceRecorder() {
+    stop();
+}
+
+bool TraceRecorder::start(const std::string& path) {
+    if (m_file.is_open()) {
+        return false;
+    }
+    m_file.open(path, std::ios::out | std::ios::trunc);
+    if (!m_file) {
+        std::cerr << "Warning: could not open trace file " << path << "; no trace will be written.\n";
+        return false;
+    }
+#ifndef ANTSIM_PROFILING
+    std::cerr << "Warning: this build has profiling compiled out; " << path << " will hold no events.\n";
+#endif
+
+    // Leftovers from an earlier trace in this process belong to the old time origin
+    {
+        std::lock_guard<std::mutex> lock(m_ringsMutex);
+        for (auto& ring : m_rings) {
+            ring->drain([](const TraceEvent&) {});
+        }
+    }
+    m_ringsNamed = 0;
+    m_firstEvent = true;
+    m_origin = std::chrono::steady_clock::now();
+    m_file << "[";
+    m_stopWriter = false;
+    s_active.store(true);
+    m_writer = std::thread(&TraceRecorder::writerLoop, this);
+    return true;
+}
+
+void TraceRecorder::stop() {
+    if (!m_file.is_open()) {
+        return;
+    }
+    s_active.store(false);
+    {
+        std::lock_guard<std::mutex> lock(m_writerMutex);
+        m_stopWriter = true;
+    }
+    m_writerWake.notify_one();
+    if (m_writer.joinable()) {
+        m_writer.join();
+    }
+    flush();
+
+    // Report any events lost to full rings as instant events at the end of the trace
+    const double endUs = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - m_origin).count();
+    std::lock_guard<std::mutex> lock(m_ringsMutex);
+    for (const auto& ring : m_rings) {
+        if (ring->dropped() > 0) {
+            char line[160];
+            std::snprintf(line, sizeof(line),
+                "{\"name\":\"dropped events\",\"ph\":\"i\",\"s\":\"t\",\"pid\":1,\"tid\":%u,\"ts\":%.3f,\"args\":{\"count\":%llu}}",
+                ring->threadID(), endUs, ring->dropped());
+            writeEvent(line);
+        }
+    }
+    m_file << "\n]\n";
+    m_file.close();
+}
+
+void TraceRecorder::setThreadName(const std::string& name) {
+    t_threadName = name;
+}
+
+TraceRing& TraceRecorder::ringForThisThread() {
+    if (t_ring == nullptr) {
+        std::lock_guard<std::mutex> lock(m_ringsMutex);
+        const std::string name = t_threadName.empty() ? "thread " + std::to_string(m_rings.size()) : t_threadName;
+        m_rings.push_back(std::make_unique<TraceRing>(static_cast<std::uint32_t>(m_rings.size()), name));
+        t_ring = m_rings.back().get();
+    }
+    return *t_ring;
+}
+
+void TraceRecorder::record(const char* name, std::int64_t arg, std::chrono::steady_clock::time_point begin,
+    std::chrono::steady_clock::time_point end) {
+    if (begin < m_origin) {
+        begin = m_origin; // Scope opened just before the trace started
+    }
+    TraceEvent event;
+    event.name = name;
+    event.arg = arg;
+    event.startNs = static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(begin - m_origin).count());
+    event.durationNs = static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(end - begin).count());
+    ringForThisThread().push(event);
+}
+
+void TraceRecorder::writerLoop() {
+    std::unique_lock<std::mutex> lock(m_writerMutex);
+    while (!m_stopWriter) {
+        m_writerWake.wait_for(lock, FLUSH_INTERVAL, [this] { return m_stopWriter; });
+        lock.unlock();
+        flush();
+        lock.lock();
+    }
+}
+
+void TraceRecorder::flush() {
+    std::vector<TraceRing*> rings;
+    {
+        std::lock_guard<std::mutex> lock(m_ringsMutex);
+        for (const auto& ring : m_rings) {
+            rings.push_back(ring.get());
+        }
+    }
+
+    char line[256];
+    for (; m_ringsNamed < rings.size(); ++m_ringsNamed) {
+        const TraceRing& ring = *rings[m_ringsNamed];
+        writeEvent("{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" + std::to_string(ring.threadID())
+            + ",\"args\":{\"name\":\"" + escapeJson(ring.threadName()) + "\"}}");
+    }
+    for (TraceRing* ring : rings) {
+        const std::uint32_t tid = ring->threadID();
+        ring->drain([&](const TraceEvent& event) {
+            if (event.arg == TraceEvent::NO_ARG) {
+                std::snprintf(line, sizeof(line), "{\"name\":\"%s\",\"ph\":\"X\",\"pid\":1,\"tid\":%u,\"ts\":%.3f,\"dur\":%.3f}",
+                    event.name, tid, event.startNs / 1000.0, event.durationNs / 1000.0);
+            }
+            else {
+                std::snprintf(line, sizeof(line), "{\"name\":\"%s\",\"ph\":\"X\",\"pid\":1,\"tid\":%u,\"ts\":%.3f,\"dur\":%.3f,\"args\":{\"id\":%lld}}",
+                    event.name, tid, event.startNs / 1000.0, event.durationNs / 1000.0, static_cast<long long>(event.arg));
+            }
+            writeEvent(line);
+        });
+    }
+    m_file.flush();
+}
+
+void TraceRecorder::writeEvent(const std::string& json) {
+    m_file << (m_firstEvent ? "\n" : ",\n") << json;
+    m_firstEvent = false;
+}
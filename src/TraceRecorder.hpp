@@ -0,0 +1,166 @@
+// AntSimulation - An SFML simulation of an ant colony.
+// Copyright (C) 2025 Logan Herrera <jherre36@live.nmhu.edu>
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+
+#ifndef TRACE_RECORDER_HPP
+#define TRACE_RECORDER_HPP
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+// Opt-in timeline recorder (--trace FILE) writing the Chrome trace-event JSON format, which
+// chrome://tracing and ui.perfetto.dev open directly.
+// Every ANTSIM_PROFILE_SCOPE also becomes a trace event while a trace is running, and ANTSIM_TRACE_SCOPE
+// adds trace-only events tagged with a number (e.g. the colony index).
+// Each thread appends to its own lock-free ring; a background writer drains the rings into the file, so
+// recording never waits on disk. If a ring is full (the writer fell behind) the event is dropped and counted.
+// Events are "complete" events (begin timestamp + duration), so a dropped event cannot unbalance the timeline.
+
+struct TraceEvent {
+    const char* name;      // Must have static storage (string literal or a profile section name)
+    std::int64_t arg;      // Shown as args.id; NO_ARG hides it
+    std::uint64_t startNs; // Since the trace started
+    std::uint64_t durationNs;
+
+    static constexpr std::int64_t NO_ARG = -1;
+};
+
+// Single producer (the owning thread) / single consumer (the writer) ring of events
+class TraceRing {
+public:
+    static constexpr size_t CAPACITY = size_t(1) << 15; // Power of two
+
+    TraceRing(std::uint32_t threadID, const std::string& threadName);
+
+    std::uint32_t threadID() const { return m_threadID; }
+    const std::string& threadName() const { return m_threadName; }
+
+    // Producer side. Returns false (and counts a drop) when the ring is full.
+    bool push(const TraceEvent& event);
+
+    // Consumer side: hands every queued event to sink, oldest first. Returns how many were drained.
+    template <typename Sink>
+    size_t drain(Sink&& sink) {
+        const size_t tail = m_tail.load(std::memory_order_relaxed);
+        const size_t head = m_head.load(std::memory_order_acquire);
+        for (size_t i = tail; i != head; ++i) {
+            sink(m_events[i & (CAPACITY - 1)]);
+        }
+        m_tail.store(head, std::memory_order_release);
+        return head - tail;
+    }
+
+    unsigned long long dropped() const { return m_dropped.load(std::memory_order_relaxed); }
+
+private:
+    std::uint32_t m_threadID;
+    std::string m_threadName;
+    std::vector<TraceEvent> m_events;
+    alignas(64) std::atomic<size_t> m_head; // Written by the producer
+    alignas(64) std::atomic<size_t> m_tail; // Written by the consumer
+    std::atomic<unsigned long long> m_dropped;
+};
+
+class TraceRecorder {
+public:
+    static constexpr std::chrono::milliseconds FLUSH_INTERVAL{ 20 };
+
+    static TraceRecorder& instance();
+
+    // Starts writing to path. Returns false if a trace is already running or the file cannot be opened.
+    bool start(const std::string& path);
+    // Drains every ring, closes the JSON and stops the writer. Safe to call when no trace is running.
+    void stop();
+
+    // Cheap check done by every scope before it records anything
+    static bool isActive() { return s_active.load(std::memory_order_acquire); }
+
+    // Records a finished scope on the calling thread
+    void record(const char* name, std::int64_t arg, std::chrono::steady_clock::time_point begin,
+        std::chrono::steady_clock::time_point end);
+
+    // Names the calling thread in the timeline (call before its first event)
+    static void setThreadName(const std::string& name);
+
+    ~TraceRecorder();
+
+private:
+    TraceRecorder() = default;
+
+    static std::atomic<bool> s_active;
+
+    std::mutex m_ringsMutex; // Guards m_rings (threads register on their first event)
+    std::vector<std::unique_ptr<TraceRing>> m_rings;
+    size_t m_ringsNamed = 0; // Rings whose thread_name metadata has been written (writer thread only)
+
+    std::ofstream m_file;
+    bool m_firstEvent = true;
+    std::chrono::steady_clock::time_point m_origin;
+    std::thread m_writer;
+    std::mutex m_writerMutex;
+    std::condition_variable m_writerWake;
+    bool m_stopWriter = false;
+
+    TraceRing& ringForThisThread();
+    void writerLoop();
+    void flush(); // Writer thread only (or after it has been joined)
+    void writeEvent(const std::string& json);
+};
+
+// Times a scope into the trace only (no rolling statistics)
+class TraceScope {
+public:
+    TraceScope(const char* name, std::int64_t arg)
+        : m_name(name), m_arg(arg), m_active(TraceRecorder::isActive())
+    {
+        if (m_active) {
+            m_start = std::chrono::steady_clock::now();
+        }
+    }
+    ~TraceScope() {
+        if (m_active) {
+            TraceRecorder::instance().record(m_name, m_arg, m_start, std::chrono::steady_clock::now());
+        }
+    }
+
+    TraceScope(const TraceScope&) = delete;
+    TraceScope& operator=(const TraceScope&) = delete;
+
+private:
+    const char* m_name;
+    std::int64_t m_arg;
+    bool m_active;
+    std::chrono::steady_clock::time_point m_start;
+};
+
+#ifdef ANTSIM_PROFILING
+#define ANTSIM_TRACE_CONCAT_INNER(a, b) a##b
+#define ANTSIM_TRACE_CONCAT(a, b) ANTSIM_TRACE_CONCAT_INNER(a, b)
+#define ANTSIM_TRACE_SCOPE(name, arg) \
+    TraceScope ANTSIM_TRACE_CONCAT(antsimTraceScope, __LINE__)(name, static_cast<std::int64_t>(arg))
+#else
+#define ANTSIM_TRACE_SCOPE(name, arg) ((void)0)
+#endif
+
+#endif // TRACE_RECORDER_HPP
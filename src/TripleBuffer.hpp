@@ -0,0 +1,68 @@
+// AntSimulation - An SFML simulation of an ant colony.
+// Copyright (C) 2025 Logan Herrera <jherre36@live.nmhu.edu>
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#ifndef TRIPLE_BUFFER_HPP
+#define TRIPLE_BUFFER_HPP
+
+#include <atomic>
+#include <cstdint>
+
+// Lock-free single producer / single consumer triple buffer.
+// The producer fills the back slot and publishes it; the consumer always reads the newest published slot.
+// Neither side ever waits for the other: a slow consumer simply skips snapshots, and the producer never
+// writes into the slot being read. Slots are reused, so T's buffers keep their capacity between swaps.
+template <typename T>
+class TripleBuffer {
+public:
+    TripleBuffer() : m_back(0), m_middle(1), m_front(2) {}
+
+    TripleBuffer(const TripleBuffer&) = delete;
+    TripleBuffer& operator=(const TripleBuffer&) = delete;
+
+    // --- Producer side ---
+    T& writeBuffer() { return m_slots[m_back]; }
+
+    // Makes the write buffer the newest snapshot and takes the previous middle slot as the next write buffer
+    void publish() {
+        const std::uint8_t previous = m_middle.exchange(static_cast<std::uint8_t>(m_back | FRESH_BIT), std::memory_order_acq_rel);
+        m_back = previous & SLOT_MASK;
+    }
+
+    // --- Consumer side ---
+    // Switches to the newest published snapshot if there is one. Returns true if it changed.
+    bool acquire() {
+        if ((m_middle.load(std::memory_order_relaxed) & FRESH_BIT) == 0) {
+            return false;
+        }
+        const std::uint8_t previous = m_middle.exchange(m_front, std::memory_order_acq_rel);
+        m_front = previous & SLOT_MASK;
+        return true;
+    }
+
+    // The snapshot acquired last; stays valid and unchanged until the next acquire()
+    const T& readBuffer() const { return m_slots[m_front]; }
+
+private:
+    static constexpr std::uint8_t SLOT_MASK = 0x3;
+    static constexpr std::uint8_t FRESH_BIT = 0x4; // Set on the middle slot when it holds an unread snapshot
+
+    T m_slots[3];
+    std::uint8_t m_back;                // Owned by the producer
+    std::atomic<std::uint8_t> m_middle; // Exchanged by both sides
+    std::uint8_t m_front;               // Owned by the consumer
+};
+
+#endif // TRIPLE_BUFFER_HPP
@@ -0,0 +1,70 @@
+// AntSimulation - An SFML simulation of an ant colony.
+// Copyright (C) 2025 Logan Herrera <jherre36@live.nmhu.edu>
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#include "WorldSnapshot.hpp"
+#include "Simulation.hpp"
+
+void WorldSnapshot::capture(const Simulation& sim) {
+    tick = sim.getTickCount();
+    world = sim.getWorldCount();
+    width = sim.env.width;
+    height = sim.env.height;
+
+    colonies.resize(sim.colonies.size());
+    for (size_t c = 0; c < sim.colonies.size(); ++c) {
+        colonies[c].capture(sim.colonies[c]);
+    }
+
+    food.revision = sim.env.foodRevision();
+    food.totalFoodSources = sim.env.totalFoodSources;
+    food.placedCells.assign(sim.env.placedFoodCells().begin(), sim.env.placedFoodCells().end());
+    food.depletedCells.assign(sim.env.depletedFoodCells().begin(), sim.env.depletedFoodCells().end());
+}
+
+void ColonySnapshot::capture(const Colony& colony) {
+    homeX = colony.homeX;
+    homeY = colony.homeY;
+    color = colony.colonyColor;
+    peakPopulation = colony.peakPopulation;
+    totalAntsDied = colony.totalAntsDied;
+
+    // Only living ants are copied, so the renderer never sees free slots
+    const AntStore& ants = colony.ants;
+    antX.clear();
+    antY.clear();
+    antDirection.clear();
+    antLifespan.clear();
+    antHasFood.clear();
+    for (size_t i = 0; i < ants.slotCount(); ++i) {
+        if (!ants.alive[i]) {
+            continue;
+        }
+        antX.push_back(ants.x[i]);
+        antY.push_back(ants.y[i]);
+        antDirection.push_back(ants.direction[i]);
+        antLifespan.push_back(ants.lifespan[i]);
+        antHasFood.push_back(ants.hasFood[i]);
+    }
+
+    pheromoneCells.clear();
+    homeLevels.clear();
+    foodLevels.clear();
+    colony.pheromones.forEachActiveCell([this](std::uint64_t cell, float homeLevel, float foodLevel) {
+        pheromoneCells.push_back(cell);
+        homeLevels.push_back(homeLevel);
+        foodLevels.push_back(foodLevel);
+    });
+}
@@ -0,0 +1,70 @@
+// AntSimulation - An SFML simulation of an ant colony.
+// Copyright (C) 2025 Logan Herrera <jherre36@live.nmhu.edu>
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#ifndef WORLD_SNAPSHOT_HPP
+#define WORLD_SNAPSHOT_HPP
+
+#include <SFML/Graphics.hpp>
+#include <cstdint>
+#include <vector>
+
+class Colony;
+class Simulation;
+
+// Everything the window needs to draw one colony, copied out of the simulation after a tick
+struct ColonySnapshot {
+    int homeX = 0, homeY = 0;
+    sf::Color color;
+    unsigned long long peakPopulation = 0;
+    unsigned long long totalAntsDied = 0;
+
+    // Live ants (copies of the AntStore arrays the renderer uses)
+    std::vector<int> antX, antY, antDirection, antLifespan;
+    std::vector<std::uint8_t> antHasFood;
+
+    // Cells holding pheromone with their levels in real units; every other cell is empty
+    std::vector<std::uint64_t> pheromoneCells;
+    std::vector<float> homeLevels, foodLevels;
+
+    // Copies one colony's current state (vectors are reassigned in place, like WorldSnapshot::capture)
+    void capture(const Colony& colony);
+};
+
+// Food changes since the world was generated. Both lists are per world and only ever grow, so a renderer
+// that skipped some snapshots can still catch up from wherever it stopped.
+struct FoodSnapshot {
+    unsigned long long revision = 0;           // Changes whenever the food grid is regenerated
+    unsigned int totalFoodSources = 0;
+    std::vector<std::uint64_t> placedCells;    // Cells that received food when the world was generated
+    std::vector<std::uint64_t> depletedCells;  // Cells that ran out since, in the order they ran out
+};
+
+// An immutable copy of the world after one tick, handed from the simulation thread to the render thread
+struct WorldSnapshot {
+    unsigned long long tick = 0;
+    unsigned long long world = 0; // Changes on every reset, so the window knows to reset its view
+    int width = 0, height = 0;
+    bool waitingForReset = false;
+    float resetSecondsRemaining = 0.0f;
+
+    std::vector<ColonySnapshot> colonies;
+    FoodSnapshot food;
+
+    // Copies the current state of sim. Vectors are reassigned in place, so a reused snapshot does not reallocate.
+    void capture(const Simulation& sim);
+};
+
+#endif // WORLD_SNAPSHOT_HPP
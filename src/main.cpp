@@ -17,10 +17,16 @@
 
 #include <SFML/Graphics.hpp>
 #include "Ant.hpp"
+#include "AntRenderer.hpp"
 #include "Colony.hpp"
 #include "Environment.hpp"
-#include "RandomUtils.hpp" // For RandomUtils::getGenerator()
-#include <random>          // For std::uniform_int_distribution
+#include "FoodLayer.hpp"
+#include "Headless.hpp"
+#include "Options.hpp"
+#include "PheromoneOverlay.hpp"
+#include "Profiler.hpp"
+#include "SimulationThread.hpp"
+#include "TraceRecorder.hpp"
 #include <iostream>
 #include <algorithm> // For std::min, std::max
 #include <string>
@@ -36,23 +42,35 @@ const float KEY_ZOOM_FACTOR = 1.1f; // Pressing key zooms in/out by 10%
 const float MOUSE_WHEEL_ZOOM_FACTOR = 1.1f; // Scrolling zooms in/out by 10%
 // For panning control
 const float PAN_SPEED_FACTOR = 0.05f; // Panning speed relative to view size (for keys)
+// For the profiler panel (F3)
+const float PROFILE_TEXT_REFRESH_SECONDS = 0.5f; // How often the timing table is rebuilt
 
-// --- Simulation States ---
-enum SimulationState {
-    RUNNING,          // Simulation is actively running
-    WAITING_FOR_RESET // Conditions met, waiting for 3-second delay
-};
+// Forward declaration for the view reset function (called whenever a new world appears)
+void resetView(sf::View& view, int worldWidth, int worldHeight, float cellSize, float initialZoom);
 
-// Forward declaration for the reset function
-void resetSimulation(std::vector<Colony>& colonies, Environment& env, sf::Clock& gameClock, float cellSize, sf::View& view, float initialZoom, const sf::Texture& antTexture);
 
-
-constexpr float CELL_SIZE = static_cast<float>(WINDOW_WIDTH) / Environment::GRID_SIZE;
 // Was 1.4f, which zooms OUT.
 // 1.0f for no zoom, or 0.8f to zoom IN.
 const float INITIAL_DEFAULT_ZOOM_OUT = 0.8f; // Default zoom level
 
-int main() {
+int main(int argc, char* argv[]) {
+
+    SimulationOptions options;
+    if (!parseOptions(argc, argv, options)) {
+        printUsage(argv[0]);
+        return -1;
+    }
+    if (options.showHelp) {
+        printUsage(argv[0]);
+        return 0;
+    }
+    // Headless runs never touch the window, texture or font
+    if (options.headless) {
+        return runHeadless(options);
+    }
+
+    // Fit the world's width to the window; cells stay square
+    const float CELL_SIZE = static_cast<float>(WINDOW_WIDTH) / options.gridWidth;
 
     sf::RenderWindow window(sf::VideoMode(WINDOW_WIDTH, WINDOW_HEIGHT), "Ant Colony Simulation");
     window.setFramerateLimit(60);
@@ -66,6 +84,9 @@ int main() {
 
     // For crisp pixel art, disable smoothing
     antTexture.setSmooth(false);
+
+    // Ants only store simulation state; the renderer builds one batched quad per ant when a frame is drawn
+    AntRenderer antRenderer(antTexture, CELL_SIZE);
     // --- End Load Ant Texture ---
 
     // --- Load a Font ---
@@ -148,6 +169,16 @@ int main() {
     foodText.setFillColor(sf::Color::Blue);
     foodText.setPosition(10.f, 110.f);
 
+    // Optional profiler panel (F3): rolling per-phase timings of the simulation and render threads
+    sf::Text profileText;
+    profileText.setFont(font);
+    profileText.setCharacterSize(18);
+    profileText.setFillColor(sf::Color::Black);
+    profileText.setPosition(10.f, 150.f);
+    bool showProfiler = false;
+    sf::Clock profileTextClock; // The table is rebuilt a few times a second, not every frame
+    ProfileLog profileLog(options.profileLog);
+
 	// Text for reset timer
     sf::Text resetTimerText;
     resetTimerText.setFont(font);
@@ -157,29 +188,31 @@ int main() {
 
 
     // --- Initial Simulation Setup ---
-    Environment env(CELL_SIZE);
-    std::vector<Colony> colonies;
-    colonies.reserve(3);
-
-    std::uniform_int_distribution<> grid_distrib(0, Environment::GRID_SIZE - 1);
-
-    // Lighter color palette
-    sf::Color colony1Color = sf::Color(128, 128, 128); // A medium-light grey instead of black
-    sf::Color colony2Color = sf::Color(255, 100, 100); // A lighter red
-    sf::Color colony3Color = sf::Color(100, 100, 255); // A lighter blue
-
-    colonies.emplace_back(grid_distrib(RandomUtils::getGenerator()), grid_distrib(RandomUtils::getGenerator()), 5, CELL_SIZE, colony1Color, Colony::nextColonyID++, antTexture);
-    colonies.emplace_back(grid_distrib(RandomUtils::getGenerator()), grid_distrib(RandomUtils::getGenerator()), 5, CELL_SIZE, colony2Color, Colony::nextColonyID++, antTexture);
-    colonies.emplace_back(grid_distrib(RandomUtils::getGenerator()), grid_distrib(RandomUtils::getGenerator()), 5, CELL_SIZE, colony3Color, Colony::nextColonyID++, antTexture);
+    TraceRecorder::setThreadName("render");
+    if (!options.traceFile.empty()) {
+        TraceRecorder::instance().start(options.traceFile);
+    }
+    // The simulation ticks on its own thread; this thread only draws the snapshots it publishes
+    SimulationThread simThread(options, CELL_SIZE);
+    std::cout << "Simulation seed: " << options.seed << " (pass --seed " << options.seed << " to replay this run)\n";
+    const WorldSnapshot* snapshot = &simThread.latestSnapshot();
+    const int worldWidth = snapshot->width;
+    const int worldHeight = snapshot->height;
+    unsigned long long shownWorld = snapshot->world; // Used to notice resets and re-center the view
+
+    // One pheromone overlay per colony slot; colonies keep their slot across resets
+    std::vector<PheromoneOverlay> pheromoneOverlays;
+    pheromoneOverlays.reserve(snapshot->colonies.size());
+    for (size_t c = 0; c < snapshot->colonies.size(); ++c) {
+        pheromoneOverlays.emplace_back(worldWidth, worldHeight, CELL_SIZE);
+    }
+    FoodLayer foodLayer(worldWidth, worldHeight, CELL_SIZE);
     // --- End Initial Simulation Setup ---
 
 
     // --- View Setup ---
     sf::View view;
-    float gridWorldDimension = static_cast<float>(Environment::GRID_SIZE) * CELL_SIZE;
-    view.setSize(gridWorldDimension, gridWorldDimension);
-    view.setCenter(gridWorldDimension / 2.0f, gridWorldDimension / 2.0f);
-    view.zoom(INITIAL_DEFAULT_ZOOM_OUT);
+    resetView(view, worldWidth, worldHeight, CELL_SIZE, INITIAL_DEFAULT_ZOOM_OUT);
     window.setView(view);
     // --- End of View Setup ---
 
@@ -187,17 +220,11 @@ int main() {
     bool isPanning = false;
     sf::Vector2i lastMousePos;
 
-	// Clock for simulation timing
-    sf::Clock clock;
-	//currently half a second per update, can be adjusted
-	float simulationSpeed = 0.05f; // Speed of simulation in seconds per update
-
-    SimulationState currentSimulationState = RUNNING;
-	sf::Clock resetTimerClock; // Clock to track reset delay
-    const float RESET_DELAY_SECONDS = 3.0f;
+	// Simulation timing (SimulationThread::TICK_INTERVAL) and the reset countdown run on the simulation thread
 
 
     while (window.isOpen()) {
+        ANTSIM_PROFILE_SCOPE("frame");
         sf::Event event;
 		// Process events
         while (window.pollEvent(event)) {
@@ -335,163 +362,108 @@ int main() {
                     view.move(panAmount, 0.f);
                     window.setView(view);
                 }
+                // Toggle the profiler panel with F3
+                else if (event.key.code == sf::Keyboard::F3) {
+                    showProfiler = !showProfiler;
+                    profileTextClock.restart();
+                    profileText.setString(Profiler::instance().formatTable());
+                }
                 // Reset the simulation with 'R' key
                 else if (event.key.code == sf::Keyboard::R) {
-                    resetSimulation(colonies, env, clock, CELL_SIZE, view, INITIAL_DEFAULT_ZOOM_OUT, antTexture);
-                    currentSimulationState = RUNNING;
-                    std::cout << "Simulation reset.\n";
+                    simThread.requestReset(); // The view follows once the new world's snapshot arrives
 				}
             }
         }
 
         // --- Update Logic ---
-        if (currentSimulationState == RUNNING) {
-            sf::Time elapsed = clock.getElapsedTime();
-            if (elapsed.asMilliseconds() > static_cast<sf::Int32>(simulationSpeed * 1000.0f)) {
-                for (auto& colony : colonies) {
-                    colony.update(env, colonies);
-                }
-                clock.restart();
-
-                long long totalLiveAnts = 0;
-                for (const auto& colony : colonies) {
-                    totalLiveAnts += colony.ants.size();
-                }
-
-                if (env.totalFoodSources == 0 || totalLiveAnts == 0) {
-                    currentSimulationState = WAITING_FOR_RESET;
-                    resetTimerClock.restart();
-                    std::cout << "Reset condition met. Restarting in " << RESET_DELAY_SECONDS << " seconds...\n";
-                }
-            }
+        // Pick up the newest complete tick; never waits for the simulation thread
+        snapshot = &simThread.latestSnapshot();
+        if (snapshot->world != shownWorld) {
+            shownWorld = snapshot->world;
+            resetView(view, worldWidth, worldHeight, CELL_SIZE, INITIAL_DEFAULT_ZOOM_OUT);
+            std::cout << "New colonies created. View reset.\n";
         }
-        else if (currentSimulationState == WAITING_FOR_RESET) {
-            float timeRemaining = RESET_DELAY_SECONDS - resetTimerClock.getElapsedTime().asSeconds();
-            if (timeRemaining <= 0) {
-                resetSimulation(colonies, env, clock, CELL_SIZE, view, INITIAL_DEFAULT_ZOOM_OUT, antTexture);
-                currentSimulationState = RUNNING;
-                std::cout << "Simulation restarted.\n";
-            }
-            resetTimerText.setString("Restarting in " + std::to_string(static_cast<int>(std::max(0.0f, timeRemaining))) + "s");
+        if (snapshot->waitingForReset) {
+            resetTimerText.setString("Restarting in " + std::to_string(static_cast<int>(std::max(0.0f, snapshot->resetSecondsRemaining))) + "s");
         }
 
 
         // --- Update Text ---
         long long totalLiveAnts = 0, totalPeakPopulation = 0, totalDeaths = 0;
-        for (const auto& colony : colonies) {
-            totalLiveAnts += colony.ants.size();
+        for (const auto& colony : snapshot->colonies) {
+            totalLiveAnts += colony.antX.size();
             totalPeakPopulation += colony.peakPopulation;
             totalDeaths += colony.totalAntsDied;
         }
         populationText.setString("Total Live Ants: " + std::to_string(totalLiveAnts) +
             "\nPeak Population: " + std::to_string(totalPeakPopulation));
         deathText.setString("Total Deaths: " + std::to_string(totalDeaths));
-        foodText.setString("Food Sources: " + std::to_string(env.totalFoodSources));
+        foodText.setString("Food Sources: " + std::to_string(snapshot->food.totalFoodSources));
+        if (showProfiler && profileTextClock.getElapsedTime().asSeconds() >= PROFILE_TEXT_REFRESH_SECONDS) {
+            profileTextClock.restart();
+            profileText.setString(Profiler::instance().formatTable());
+        }
+        profileLog.maybeWrite();
 
 
         // --- Drawing ---
         window.clear(sf::Color::White);
         window.setView(view); // Apply the main view for simulation elements
 
-        for (const auto& colony : colonies) {
+        for (const auto& colony : snapshot->colonies) {
             sf::CircleShape colonyHomeShape(CELL_SIZE * 1.5f);
-            colonyHomeShape.setFillColor(colony.colonyColor);
+            colonyHomeShape.setFillColor(colony.color);
             colonyHomeShape.setOrigin(colonyHomeShape.getRadius(), colonyHomeShape.getRadius());
             colonyHomeShape.setPosition((static_cast<float>(colony.homeX) + 0.5f) * CELL_SIZE, (static_cast<float>(colony.homeY) + 0.5f) * CELL_SIZE);
             window.draw(colonyHomeShape);
         }
 
-        for (const auto& colony : colonies) {
-            for (int i = 0; i < Environment::GRID_SIZE; i++) {
-                for (int j = 0; j < Environment::GRID_SIZE; j++) {
-                    float homePheromoneValue = colony.returnHomePheromones[i][j];
-                    if (homePheromoneValue > 0.01f) {
-                        sf::RectangleShape pheromoneShape(sf::Vector2f(CELL_SIZE, CELL_SIZE));
-                        pheromoneShape.setPosition(static_cast<float>(i * CELL_SIZE), static_cast<float>(j * CELL_SIZE));
-                        sf::Color baseColor = colony.colonyColor;
-                        sf::Uint8 alpha = static_cast<sf::Uint8>(std::min(255.0f, homePheromoneValue * 2.5f));
-                        pheromoneShape.setFillColor(sf::Color(std::min(255, baseColor.r + 50), std::min(255, baseColor.g + 50), std::min(255, baseColor.b + 50), alpha));
-                        window.draw(pheromoneShape);
-                    }
-                    float foodPheromoneValue = colony.foodPheromones[i][j];
-                    if (foodPheromoneValue > 0.01f) {
-                        sf::RectangleShape pheromoneShape(sf::Vector2f(CELL_SIZE, CELL_SIZE));
-                        pheromoneShape.setPosition(static_cast<float>(i * CELL_SIZE), static_cast<float>(j * CELL_SIZE));
-                        sf::Uint8 alpha = static_cast<sf::Uint8>(std::min(255.0f, foodPheromoneValue * 4.0f));
-                        pheromoneShape.setFillColor(sf::Color(255, 215, 0, alpha)); // Gold
-                        window.draw(pheromoneShape);
-                    }
-                }
+        // Each colony's trails are one texture; only rows that changed are re-uploaded
+        {
+            ANTSIM_PROFILE_SCOPE("frame.pheromones");
+            for (size_t c = 0; c < snapshot->colonies.size() && c < pheromoneOverlays.size(); ++c) {
+                pheromoneOverlays[c].update(snapshot->colonies[c]);
+                pheromoneOverlays[c].draw(window);
             }
         }
         
-		// Draw each ant in the colonies
-        for (auto& colony : colonies) { // Must be non-const to modify sprite color
-            for (auto& ant : colony.ants) { // Must be non-const to modify sprite color
-
-                // Color logic
-                sf::Color antColor = ant.getColonyColor();
-                if (ant.hasFood) {
-                    antColor = sf::Color::Green;
-                }
-
-                // Lifespan fade effect
-                if (ant.lifespan < 50 && ant.lifespan > 0) {
-                    // Fade to a darker/greyer version of the original color
-                    float fadeRatio = static_cast<float>(ant.lifespan) / 50.f;
-                    antColor.r = static_cast<sf::Uint8>(antColor.r * fadeRatio);
-                    antColor.g = static_cast<sf::Uint8>(antColor.g * fadeRatio);
-                    antColor.b = static_cast<sf::Uint8>(antColor.b * fadeRatio);
-                }
-                else if (ant.lifespan <= 0) {
-                    antColor = sf::Color::Transparent; // Make dead ants invisible
-                }
-
-                ant.sprite.setColor(antColor); // Apply the final color tint
-
-                // The ant's position and rotation are already set by ant.updateGraphics(),
-                // so we just need to draw it.
-                window.draw(ant.sprite);
-            }
+		// Draw each ant in the colonies (a single draw call for all of them)
+        {
+            ANTSIM_PROFILE_SCOPE("frame.ants");
+            antRenderer.draw(window, *snapshot);
         }
 
-
-        env.renderFood(window);
+        // Food is cached in a texture; only cells eaten since the last frame are patched
+        {
+            ANTSIM_PROFILE_SCOPE("frame.food");
+            foodLayer.update(snapshot->food);
+            foodLayer.draw(window);
+        }
 
         // Switch to default view for UI elements
         window.setView(window.getDefaultView());
         window.draw(populationText);
         window.draw(deathText);
         window.draw(foodText);
-        if (currentSimulationState == WAITING_FOR_RESET) {
+        if (showProfiler) {
+            window.draw(profileText);
+        }
+        if (snapshot->waitingForReset) {
             window.draw(resetTimerText);
         }
-        window.display();
+        {
+            ANTSIM_PROFILE_SCOPE("frame.display");
+            window.display();
+        }
     }
+    TraceRecorder::instance().stop();
     return 0;
 }
-// resetSimulation function to reset and reinitialize the simulation state
-void resetSimulation(std::vector<Colony>& colonies, Environment& env, sf::Clock& gameClock, float cellSize, sf::View& view, float initialZoom, const sf::Texture& antTexture) {
-    colonies.clear();
-    env.generateFood();
-    Colony::nextColonyID = 0;
-
-    std::uniform_int_distribution<> grid_distrib(0, Environment::GRID_SIZE - 1);
-
-    // Lighter color palette
-    sf::Color colony1Color = sf::Color(128, 128, 128); // A medium-light grey instead of black
-    sf::Color colony2Color = sf::Color(255, 100, 100); // A lighter red
-    sf::Color colony3Color = sf::Color(100, 100, 255); // A lighter blue
-
-    colonies.emplace_back(grid_distrib(RandomUtils::getGenerator()), grid_distrib(RandomUtils::getGenerator()), 5, cellSize, colony1Color, Colony::nextColonyID++, antTexture);
-    colonies.emplace_back(grid_distrib(RandomUtils::getGenerator()), grid_distrib(RandomUtils::getGenerator()), 5, cellSize, colony2Color, Colony::nextColonyID++, antTexture);
-    colonies.emplace_back(grid_distrib(RandomUtils::getGenerator()), grid_distrib(RandomUtils::getGenerator()), 5, cellSize, colony3Color, Colony::nextColonyID++, antTexture);
-
-    float gridWorldDimension = static_cast<float>(Environment::GRID_SIZE) * cellSize;
-    view.setSize(gridWorldDimension, gridWorldDimension);
-    view.setCenter(gridWorldDimension / 2.0f, gridWorldDimension / 2.0f);
+// resetView function to fit the whole world in the view again at the initial zoom
+void resetView(sf::View& view, int worldWidth, int worldHeight, float cellSize, float initialZoom) {
+    float gridWorldWidth = static_cast<float>(worldWidth) * cellSize;
+    float gridWorldHeight = static_cast<float>(worldHeight) * cellSize;
+    view.setSize(gridWorldWidth, gridWorldHeight);
+    view.setCenter(gridWorldWidth / 2.0f, gridWorldHeight / 2.0f);
     view.zoom(initialZoom);
-
-    gameClock.restart();
-    std::cout << "Simulation data reset. New colonies created. View reset.\n";
 }